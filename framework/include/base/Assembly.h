@@ -366,6 +366,14 @@ public:
    */
   void useFECache(bool fe_cache) { _should_use_fe_cache = fe_cache; }
 
+  /**
+   * Whether or not this assembly should reuse the shape functions computed on an element for all
+   * of the elements with the same geometry up to a translation.
+   *
+   * @param fe_geometry_cache True for using the cache false for not.
+   */
+  void useFEGeometryCache(bool fe_geometry_cache);
+
   void prepare();
   void prepareNonlocal();
 
@@ -415,6 +423,20 @@ public:
    */
   void cacheResidualNodes(DenseVector<Number> & res, std::vector<dof_id_type> & dof_index);
 
+  /**
+   * Cache the residual of an element other than the current one (e.g. computed by a batched
+   * Kernel), applying the constraints and the scaling like cacheResidual() does.
+   *
+   * @param res_block The element residual of one variable
+   * @param dof_indices The dof indices of that variable on the element
+   * @param scaling_factor The scaling factor of the variable
+   * @param type Whether the contribution should go to the Time or Non-Time residual
+   */
+  void cacheResidualBlock(DenseVector<Number> & res_block,
+                          std::vector<dof_id_type> & dof_indices,
+                          Real scaling_factor,
+                          Moose::KernelType type = Moose::KT_NONTIME);
+
   /**
    * Takes the values that are currently in _sub_Ke and appends them to the cached values.
    */
@@ -455,6 +477,55 @@ public:
   void addJacobianScalar(SparseMatrix<Number> & jacobian);
   void addJacobianOffDiagScalar(SparseMatrix<Number> & jacobian, unsigned int ivar);
 
+  /**
+   * Prepares this object for applying element Jacobians to a vector instead of assembling them
+   * (see ComputeJacobianActionThread). The operator couples every pair of variables, whatever the
+   * coupling of the preconditioning matrix, so every pair gets its own element block.
+   */
+  void initJacobianAction();
+
+  /**
+   * Switches the element blocks to one block per pair of variables for the duration of a
+   * Jacobian action, endJacobianAction() switches back to the blocks used to assemble the
+   * preconditioning matrix and drops any values left in the cache.
+   */
+  void beginJacobianAction();
+  void endJacobianAction();
+
+  /**
+   * Sets the vector the element Jacobians are applied to. It has to be ghosted.
+   */
+  void setJacobianActionDirection(const NumericVector<Number> * direction)
+  {
+    _jacobian_action_direction = direction;
+  }
+
+  /**
+   * Zeros the element blocks of all pairs of variables and the Jacobian action blocks, and reads
+   * the values of the direction on the current element. Call after prepare().
+   */
+  void prepareJacobianAction();
+
+  /**
+   * Caches the action of the element Jacobian on the direction: the Jacobian action blocks
+   * computed by kernels plus the product of the used element blocks with the direction.
+   */
+  void cacheJacobianAction();
+
+  /**
+   * Adds the values that have been cached by calling cacheJacobianAction() to y, then clears the
+   * cache.
+   */
+  void addCachedJacobianAction(NumericVector<Number> & y);
+
+  /**
+   * Replaces the rows of y that have previously-cached Jacobian values (i.e. the rows set by
+   * NodalBCs) by the product of these values with x. This is the counterpart of
+   * setCachedJacobianContributions() for the matrix-free operator.
+   */
+  void applyCachedJacobianContributions(const NumericVector<Number> & x,
+                                        NumericVector<Number> & y);
+
   /**
    * Takes the values that are currently in _sub_Kee and appends them to the cached values.
    */
@@ -508,6 +579,18 @@ public:
   {
     return _cm_nonlocal_entry;
   }
+  std::vector<std::pair<MooseVariable *, MooseVariable *>> & jacobianActionEntries()
+  {
+    return _jacobian_action_entry;
+  }
+
+  /// Values of the direction of the Jacobian action for the dofs of a variable on the current elem
+  const DenseVector<Number> & jacobianActionDirection(unsigned int var_num)
+  {
+    return _sub_Va[var_num];
+  }
+  /// The action of the element Jacobian on the direction, computed by kernels themselves
+  DenseVector<Number> & jacobianActionBlock(unsigned int var_num) { return _sub_Ja[var_num]; }
 
   const VariablePhiValue & phi() { return _phi; }
   const VariablePhiGradient & gradPhi() { return _grad_phi; }
@@ -586,6 +669,23 @@ protected:
    */
   void reinitFE(const Elem * elem);
 
+  /**
+   * Reinits the volume FE data from the shape functions computed on a previous element with the
+   * same geometry up to a translation. They are computed and cached if there is no such element.
+   *
+   * @param elem The element we are using to reinit
+   */
+  void reinitFEFromGeometryCache(const Elem * elem);
+
+  /**
+   * Fills _fe_geometry_key with the key identifying the element type, the quadrature rule and the
+   * node positions relative to the first node of the element.
+   */
+  void buildFEGeometryKey(const Elem * elem);
+
+  /// Deletes the shape functions cached by geometry
+  void clearFEGeometryCache();
+
   /**
    * Just an internal helper function to reinit the face FE objects.
    *
@@ -650,6 +750,8 @@ protected:
   /// Entries in the coupling matrix (only for field variables)
   std::vector<std::pair<MooseVariable *, MooseVariable *>> _cm_entry;
   std::vector<std::pair<MooseVariable *, MooseVariable *>> _cm_nonlocal_entry;
+  /// All pairs of field variables, the couplings of the matrix-free Jacobian operator
+  std::vector<std::pair<MooseVariable *, MooseVariable *>> _jacobian_action_entry;
   /// Flag that indicates if the jacobian block was used
   std::vector<std::vector<unsigned char>> _jacobian_block_used;
   std::vector<std::vector<unsigned char>> _jacobian_block_nonlocal_used;
@@ -866,6 +968,21 @@ protected:
   /// Whether or not fe should currently be cached - This will be false if something funky is going on with the quadrature rules.
   bool _currently_fe_caching;
 
+  /// Whether or not the shape functions should be cached by element geometry
+  bool _should_use_fe_geometry_cache;
+
+  /**
+   * Cached shape function values stored by element geometry (see buildFEGeometryKey()). The
+   * cached _q_points are relative to the first node of the element.
+   */
+  std::map<std::vector<long long>, ElementFEShapeData *> _fe_geometry_cache;
+
+  /// Storage for the key of the current element geometry
+  std::vector<long long> _fe_geometry_key;
+
+  /// Storage for the q_points of the current element when they come from the geometry cache
+  MooseArray<Point> _fe_geometry_q_points;
+
   // Shape function values, gradients. second derivatives for each FE type
   std::map<FEType, FEShapeData *> _fe_shape_data;
   std::map<FEType, FEShapeData *> _fe_shape_data_face;
@@ -904,6 +1021,19 @@ protected:
   std::vector<Real> _cached_jacobian_contribution_vals;
   std::vector<numeric_index_type> _cached_jacobian_contribution_rows;
   std::vector<numeric_index_type> _cached_jacobian_contribution_cols;
+
+  /// The (ghosted) vector the element Jacobians are applied to
+  const NumericVector<Number> * _jacobian_action_direction;
+  /// Values of the direction on the current element for each variable
+  std::vector<DenseVector<Number>> _sub_Va;
+  /// Jacobian action for each variable computed by kernels on the current element
+  std::vector<DenseVector<Number>> _sub_Ja;
+  /// Value of _block_diagonal_matrix outside of Jacobian actions
+  bool _block_diagonal_matrix_saved;
+  /// Values and rows cached by calling cacheJacobianAction()
+  std::vector<Real> _cached_jacobian_action_values;
+  std::vector<dof_id_type> _cached_jacobian_action_rows;
+  unsigned int _max_cached_jacobian_actions;
 };
 
 #endif /* ASSEMBLY_H */
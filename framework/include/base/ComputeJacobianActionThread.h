@@ -0,0 +1,70 @@
+/****************************************************************/
+/*               DO NOT MODIFY THIS HEADER                      */
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*           (c) 2010 Battelle Energy Alliance, LLC             */
+/*                   ALL RIGHTS RESERVED                        */
+/*                                                              */
+/*          Prepared by Battelle Energy Alliance, LLC           */
+/*            Under Contract No. DE-AC07-05ID14517              */
+/*            With the U. S. Department of Energy               */
+/*                                                              */
+/*            See COPYRIGHT for full restrictions               */
+/****************************************************************/
+
+#ifndef COMPUTEJACOBIANACTIONTHREAD_H
+#define COMPUTEJACOBIANACTIONTHREAD_H
+
+#include "ThreadedElementLoop.h"
+
+// libMesh includes
+#include "libmesh/elem_range.h"
+
+// Forward declarations
+class FEProblemBase;
+class NonlinearSystemBase;
+class IntegratedBC;
+class KernelWarehouse;
+
+/**
+ * Applies the Jacobian to a vector element by element without assembling it. Kernels that
+ * implement KernelBase::computeJacobianAction() compute the action themselves; the element
+ * Jacobian blocks of all the other Kernels and IntegratedBCs are multiplied by the element values
+ * of the direction (see Assembly::prepareJacobianAction()).
+ */
+class ComputeJacobianActionThread : public ThreadedElementLoop<ConstElemRange>
+{
+public:
+  /**
+   * @param y The vector the action is added to. The direction is the one set on the Assembly
+   * objects. Values still cached by the Assembly objects after the loop have to be added with
+   * Assembly::addCachedJacobianAction().
+   */
+  ComputeJacobianActionThread(FEProblemBase & fe_problem, NumericVector<Number> & y);
+
+  // Splitting Constructor
+  ComputeJacobianActionThread(ComputeJacobianActionThread & x, Threads::split split);
+
+  virtual ~ComputeJacobianActionThread();
+
+  virtual void subdomainChanged() override;
+  virtual void onElement(const Elem * elem) override;
+  virtual void onBoundary(const Elem * elem, unsigned int side, BoundaryID bnd_id) override;
+  virtual void postElement(const Elem * /*elem*/) override;
+  virtual void post() override;
+
+  void join(const ComputeJacobianActionThread & /*y*/);
+
+protected:
+  NumericVector<Number> & _y;
+  NonlinearSystemBase & _nl;
+  unsigned int _num_cached;
+
+  // Reference to BC storage structures
+  const MooseObjectWarehouse<IntegratedBC> & _integrated_bcs;
+
+  // Reference to Kernel storage structure
+  const KernelWarehouse & _kernels;
+};
+
+#endif // COMPUTEJACOBIANACTIONTHREAD_H
@@ -50,10 +50,25 @@ public:
   void join(const ComputeResidualThread & /*y*/);
 
 protected:
+  /// The Kernels computed by this loop (depends on the KernelType)
+  const MooseObjectWarehouse<KernelBase> & kernelWarehouse() const;
+
+  /// Computes the residual of the elements gathered by the batched Kernels
+  void computeBatchedResiduals();
+
   NonlinearSystemBase & _nl;
   Moose::KernelType _kernel_type;
   unsigned int _num_cached;
 
+  /// The number of elements the batched Kernels compute at once (1 disables batching)
+  const unsigned int _residual_batch_size;
+
+  /// The Kernels of the current subdomain computing their residual in batches
+  std::vector<std::shared_ptr<KernelBase>> _batched_kernels;
+
+  /// The number of elements gathered by the batched Kernels
+  unsigned int _num_batched;
+
   /// Reference to BC storage structures
   const MooseObjectWarehouse<IntegratedBC> & _integrated_bcs;
 
@@ -66,6 +66,14 @@ public:
    */
   virtual void useFECache(bool fe_cache) override;
 
+  /**
+   * Whether or not this problem should reuse the FE shape functions between elements with the
+   * same geometry up to a translation.
+   *
+   * @param fe_geometry_cache True for using the cache false for not.
+   */
+  virtual void useFEGeometryCache(bool fe_geometry_cache) override;
+
   virtual void init() override;
   virtual void solve() override;
   virtual bool converged() override;
@@ -31,6 +31,7 @@
 #include "MaterialWarehouse.h"
 #include "MultiAppTransfer.h"
 #include "Postprocessor.h"
+#include "ObjectTimings.h"
 
 // libMesh includes
 #include "libmesh/enum_quadrature_type.h"
@@ -387,6 +388,14 @@ public:
    */
   virtual void useFECache(bool fe_cache) override;
 
+  /**
+   * Whether or not this problem should reuse the FE shape functions between elements with the
+   * same geometry up to a translation.
+   *
+   * @param fe_geometry_cache True for using the cache false for not.
+   */
+  virtual void useFEGeometryCache(bool fe_geometry_cache) override;
+
   virtual void init() override;
   virtual void solve() override;
 
@@ -1093,6 +1102,10 @@ public:
 
   void setMaterialCoverageCheck(bool flag) { _material_coverage_check = flag; }
 
+  /// The number of elements the Kernels supporting it compute at once (see
+  /// KernelBase::hasBatchedResidual())
+  unsigned int residualBatchSize() const { return _residual_batch_size; }
+
   /**
    * Updates the active boundary id
    * @param id The BoundaryID to set as active
@@ -1180,6 +1193,11 @@ public:
    */
   std::shared_ptr<MaterialData> getMaterialData(Moose::MaterialDataType type, THREAD_ID tid = 0);
 
+  /**
+   * Return a reference to the per-object timings collected in the threaded loops
+   */
+  ObjectTimings & objectTimings() { return _object_timings; }
+
   /**
    * Will return True if the user wants to get an error when
    * a nonzero is reallocated in the Jacobian by PETSc
@@ -1426,6 +1444,9 @@ protected:
   std::shared_ptr<DisplacedProblem> _displaced_problem;
   GeometricSearchData _geometric_search_data;
 
+  /// The time spent in the compute methods of the objects (only collected when requested)
+  ObjectTimings _object_timings;
+
   bool _reinit_displaced_elem;
   bool _reinit_displaced_face;
 
@@ -1467,6 +1488,9 @@ protected:
   /// Determines whether a check to verify an active material on every subdomain
   bool _material_coverage_check;
 
+  /// The number of elements the Kernels supporting it compute at once
+  const unsigned int _residual_batch_size;
+
   /// Maximum number of quadrature points used in the problem
   unsigned int _max_qps;
 
@@ -47,6 +47,12 @@ public:
 
   virtual void setupFiniteDifferencedPreconditioner() override;
 
+  /**
+   * Makes the nonlinear solver use a PETSc shell matrix applying computeJacobianAction() as the
+   * Jacobian operator; the assembled matrix is only used to build the preconditioner.
+   */
+  void setupMatrixFreeOperator();
+
   /**
    * Returns the convergence state
    * @return true if converged, otherwise false
@@ -74,6 +80,11 @@ public:
 
 protected:
   TransientNonlinearImplicitSystem & _transient_sys;
+
+#ifdef LIBMESH_HAVE_PETSC
+  /// Shell matrix applying the Jacobian for the MATRIX_FREE solve type
+  Mat _matrix_free_operator;
+#endif
 };
 
 #endif /* NONLINEARSYSTEM_H */
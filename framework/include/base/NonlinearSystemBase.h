@@ -279,6 +279,28 @@ public:
    */
   void computeJacobianBlocks(std::vector<JacobianBlock *> & blocks);
 
+  /**
+   * Whether the Jacobian of a Kernel is left out of the Jacobian being computed. The Kernels with a
+   * constant Jacobian are assembled once into a separate matrix that is added to the Jacobian,
+   * so they are skipped by the regular assembly and only they are assembled into that matrix.
+   */
+  bool skipKernelJacobian(const KernelBase & kernel) const;
+
+  /// Whether only the Kernels with a constant Jacobian are being assembled
+  bool computingConstantJacobian() const { return _computing_constant_jacobian; }
+
+  /// Makes the next Jacobian evaluation reassemble the Kernels with a constant Jacobian
+  void clearConstantJacobian() { _constant_jacobian_computed = false; }
+
+  /**
+   * Computes the action of the Jacobian on a vector without assembling the Jacobian: the element
+   * Jacobians are applied to x on the fly (see ComputeJacobianActionThread). This is the operator
+   * of the MATRIX_FREE solve type, applied at the current solution.
+   * @param x The vector the Jacobian is applied to
+   * @param y The product of the Jacobian with x is stored in here
+   */
+  void computeJacobianAction(const NumericVector<Number> & x, NumericVector<Number> & y);
+
   /**
    * Compute damping
    * @param solution The trail solution vector
@@ -493,6 +515,7 @@ public:
   const MooseObjectWarehouse<DiracKernel> & getDiracKernelWarehouse() { return _dirac_kernels; }
   const MooseObjectWarehouse<NodalKernel> & getNodalKernelWarehouse(THREAD_ID tid);
   const MooseObjectWarehouse<IntegratedBC> & getIntegratedBCWarehouse() { return _integrated_bcs; }
+  const MooseObjectWarehouse<NodalBC> & getNodalBCWarehouse() { return _nodal_bcs; }
   const MooseObjectWarehouse<ElementDamper> & getElementDamperWarehouse()
   {
     return _element_dampers;
@@ -554,6 +577,19 @@ protected:
 
   void computeJacobianInternal(SparseMatrix<Number> & jacobian, Moose::KernelType kernel_type);
 
+  /// Assembles the Kernels with a constant Jacobian into _constant_jacobian
+  void computeConstantJacobian();
+
+  /**
+   * Computes the Jacobians of the NodalBCs for the given pairs of variables and caches them in
+   * the Assembly object of thread 0
+   */
+  void cacheNodalBCJacobians(
+      const std::vector<std::pair<MooseVariable *, MooseVariable *>> & coupling_entries);
+
+  /// Checks that the matrix-free Jacobian operator supports this system and sets it up
+  void initJacobianAction();
+
   void computeDiracContributions(SparseMatrix<Number> * jacobian = NULL);
 
   void computeScalarKernelsJacobians(SparseMatrix<Number> & jacobian);
@@ -706,6 +742,18 @@ protected:
   void getNodeDofs(dof_id_type node_id, std::vector<dof_id_type> & dofs);
 
   std::vector<dof_id_type> _var_all_dof_indices;
+
+  /// Ghosted copy of the vector the matrix-free Jacobian operator is applied to
+  NumericVector<Number> * _jacobian_action_direction;
+
+  /// Jacobian contributions of the Kernels with a constant Jacobian (NULL if there are none)
+  SparseMatrix<Number> * _constant_jacobian;
+  /// Whether _constant_jacobian is up to date
+  bool _constant_jacobian_computed;
+  /// Whether _constant_jacobian is used for the Jacobian being computed
+  bool _reuse_constant_jacobian;
+  /// Whether _constant_jacobian is being assembled
+  bool _computing_constant_jacobian;
 };
 
 #endif /* NONLINEARSYSTEMBASE_H */
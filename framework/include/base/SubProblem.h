@@ -69,6 +69,14 @@ public:
    */
   virtual void useFECache(bool fe_cache) = 0;
 
+  /**
+   * Whether or not this problem should reuse the FE shape functions between elements with the
+   * same geometry up to a translation.
+   *
+   * @param fe_geometry_cache True for using the cache false for not.
+   */
+  virtual void useFEGeometryCache(bool fe_geometry_cache) = 0;
+
   virtual void solve() = 0;
   virtual bool converged() = 0;
 
@@ -20,6 +20,9 @@
 #include "MooseTypes.h"
 #include "MooseException.h"
 
+// libMesh includes
+#include "libmesh/boundary_info.h"
+
 /**
  * Base class for assembly-like calculations.
  */
@@ -115,6 +118,10 @@ protected:
 
   /// The subdomain for the last element
   SubdomainID _old_subdomain;
+
+private:
+  /// Storage for the boundary ids of a side, reused to avoid an allocation per side
+  std::vector<BoundaryID> _boundary_ids;
 };
 
 template <typename RangeType>
@@ -163,24 +170,19 @@ ThreadedElementLoopBase<RangeType>::operator()(const RangeType & range, bool byp
 
       onElement(elem);
 
+      const BoundaryInfo & boundary_info = _mesh.getMesh().get_boundary_info();
       for (unsigned int side = 0; side < elem->n_sides(); side++)
       {
-        std::vector<BoundaryID> boundary_ids = _mesh.getBoundaryIDs(elem, side);
+        boundary_info.boundary_ids(elem, side, _boundary_ids);
 
-        if (boundary_ids.size() > 0)
-          for (std::vector<BoundaryID>::iterator it = boundary_ids.begin();
-               it != boundary_ids.end();
-               ++it)
-            onBoundary(elem, side, *it);
+        for (const auto & boundary_id : _boundary_ids)
+          onBoundary(elem, side, boundary_id);
 
         if (elem->neighbor(side) != NULL)
         {
           onInternalSide(elem, side);
-          if (boundary_ids.size() > 0)
-            for (std::vector<BoundaryID>::iterator it = boundary_ids.begin();
-                 it != boundary_ids.end();
-                 ++it)
-              onInterface(elem, side, *it);
+          for (const auto & boundary_id : _boundary_ids)
+            onInterface(elem, side, boundary_id);
         }
       } // sides
       postElement(elem);
@@ -40,6 +40,8 @@ public:
 protected:
   const Real _scale_factor;
   std::unique_ptr<LinearInterpolation> _linear_interp;
+  /// Interval of the last lookup in _linear_interp (functions are created per thread)
+  unsigned int _interval_hint;
   int _axis;
   bool _has_axis;
 
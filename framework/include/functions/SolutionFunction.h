@@ -76,6 +76,16 @@ protected:
 
   /// Factor to add to the solution if gradient is requested (default = \vec{0})
   RealGradient _add_grad;
+
+  /// The thread this copy of the function is evaluated on
+  const THREAD_ID _tid;
+
+  ///@{
+  /// Storage for the point and data passed to the SolutionUserObject
+  std::vector<Point> _points;
+  std::vector<Real> _values;
+  std::vector<RealGradient> _gradients;
+  ///@}
 };
 
 #endif // SOLUTIONFUNCTION_H
@@ -21,6 +21,7 @@
 // Forward declarations
 class SubProblem;
 class MooseMesh;
+class KDTree;
 
 /**
  * Finds the nearest node to each node in boundary1 to each node in boundary2 and the other way
@@ -81,12 +82,24 @@ public:
   };
 
 protected:
+  /**
+   * Builds the tree over the trial master nodes, or refits the existing tree when the same nodes
+   * only moved since the last search (e.g. on a displaced mesh).
+   */
+  void updateMasterTree(const std::vector<dof_id_type> & trial_master_nodes);
+
   SubProblem & _subproblem;
 
   MooseMesh & _mesh;
 
   NodeIdRange * _slave_node_range;
 
+  /// Tree over the positions of the trial master nodes, used to build the slave node patches
+  std::unique_ptr<KDTree> _master_tree;
+
+  /// The trial master nodes indexed by _master_tree
+  std::vector<dof_id_type> _master_tree_nodes;
+
 public:
   std::map<dof_id_type, NearestNodeInfo> _nearest_node_info;
 
@@ -20,12 +20,14 @@
 
 // Forward declarations
 class MooseMesh;
+class KDTree;
 
 class SlaveNeighborhoodThread
 {
 public:
   SlaveNeighborhoodThread(const MooseMesh & mesh,
                           const std::vector<dof_id_type> & trial_master_nodes,
+                          const KDTree & master_tree,
                           const std::map<dof_id_type, std::vector<dof_id_type>> & node_to_elem_map,
                           const unsigned int patch_size);
 
@@ -52,6 +54,9 @@ protected:
   /// Nodes to search against
   const std::vector<dof_id_type> & _trial_master_nodes;
 
+  /// Tree over the positions of the trial master nodes (in the same order)
+  const KDTree & _master_tree;
+
   /// Node to elem map
   const std::map<dof_id_type, std::vector<dof_id_type>> & _node_to_elem_map;
 
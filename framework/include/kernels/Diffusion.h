@@ -31,10 +31,24 @@ class Diffusion : public Kernel
 public:
   Diffusion(const InputParameters & parameters);
 
+  virtual bool hasJacobianAction() const override;
+  virtual void computeJacobianAction() override;
+
+  virtual bool hasBatchedResidual() const override;
+  virtual void gatherBatchedResidual(unsigned int batch_index) override;
+  virtual void computeBatchedResidual(unsigned int batch_size) override;
+
 protected:
   virtual Real computeQpResidual() override;
 
   virtual Real computeQpJacobian() override;
+
+  /// JxW * coord * grad_u at the quadrature points of the batch, LIBMESH_DIM values per point
+  std::vector<Real> _batch_weighted_grad_u;
+
+  /// Gradients of the test functions of the batch at the quadrature points, LIBMESH_DIM values
+  /// per point, grouped by test function
+  std::vector<Real> _batch_grad_test;
 };
 
 #endif /* DIFFUSION_H */
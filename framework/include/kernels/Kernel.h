@@ -47,6 +47,28 @@ protected:
   virtual void precalculateJacobian() {}
   virtual void precalculateOffDiagJacobian(unsigned int /* jvar */) {}
 
+  ///@{
+  /// Helpers for the Kernels implementing the batched residual (see hasBatchedResidual())
+  /// Stores the dof indices and the number of quadrature points and test functions of the
+  /// current element; the derived class gathers its own quadrature point data
+  void gatherBatchedElement(unsigned int batch_index);
+  /// Caches the residuals left in _batch_residual by the derived class for batch_size elements
+  void cacheBatchedResidual(unsigned int batch_size, Moose::KernelType type = Moose::KT_NONTIME);
+  ///@}
+
+  /// Dof indices of the elements of the batch
+  std::vector<std::vector<dof_id_type>> _batch_dof_indices;
+
+  /// Offset of each element of the batch in the data gathered per quadrature point (one more
+  /// entry than elements)
+  std::vector<unsigned int> _batch_qp_offsets;
+
+  /// Offset of each element of the batch in _batch_residual (one more entry than elements)
+  std::vector<unsigned int> _batch_test_offsets;
+
+  /// Residual of the elements of the batch, one entry per test function
+  std::vector<Real> _batch_residual;
+
   /// Holds the solution at current quadrature points
   const VariableValue & _u;
 
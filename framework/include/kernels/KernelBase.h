@@ -92,6 +92,37 @@ public:
    */
   virtual void computeNonlocalOffDiagJacobian(unsigned int /* jvar */) {}
 
+  /**
+   * Whether this Kernel implements computeJacobianAction(). The matrix-free Jacobian operator
+   * applies the element Jacobian blocks of the other Kernels to the direction instead.
+   */
+  virtual bool hasJacobianAction() const { return false; }
+
+  /**
+   * Adds the action of this Kernel's element Jacobian (with respect to all the variables) on
+   * Assembly::jacobianActionDirection() to Assembly::jacobianActionBlock(), without forming the
+   * element Jacobian.
+   */
+  virtual void computeJacobianAction() {}
+
+  /**
+   * Whether this Kernel implements gatherBatchedResidual() and computeBatchedResidual().  With
+   * Problem/residual_batch_size > 1 the residual loop uses them instead of computeResidual(), so
+   * the quadrature points of several elements are evaluated in one loop.
+   */
+  virtual bool hasBatchedResidual() const { return false; }
+
+  /**
+   * Stores what computeBatchedResidual() needs from the current element in position
+   * batch_index of the batch.  The elements of a batch are gathered in order from 0.
+   */
+  virtual void gatherBatchedResidual(unsigned int /* batch_index */) {}
+
+  /**
+   * Computes the residual of the first batch_size gathered elements and caches it in Assembly.
+   */
+  virtual void computeBatchedResidual(unsigned int /* batch_size */) {}
+
   /// Returns the variable number that this Kernel operates on.
   MooseVariable & variable();
 
@@ -100,6 +131,9 @@ public:
 
   virtual bool isEigenKernel() const { return _eigen_kernel; }
 
+  /// Whether the Jacobian of this Kernel is assembled once and reused (see "constant_jacobian")
+  bool hasConstantJacobian() const { return _constant_jacobian; }
+
 protected:
   /// Reference to this kernel's SubProblem
   SubProblem & _subproblem;
@@ -177,6 +211,9 @@ protected:
   std::vector<AuxVariableName> _diag_save_in_strings;
 
   bool _eigen_kernel;
+
+  /// Whether the Jacobian of this Kernel is independent of the solution and time
+  const bool _constant_jacobian;
 };
 
 #endif /* KERNELBASE_H */
@@ -25,6 +25,7 @@
 #include <vector>
 
 class Material;
+class ObjectTimings;
 
 /**
  * Proxy for accessing MaterialPropertyStorage.
@@ -79,8 +80,15 @@ public:
   /// material properties for given element (and possible side)
   void swap(const Elem & elem, unsigned int side = 0);
 
-  /// Reinit material properties for given element (and possible side)
-  void reinit(const std::vector<std::shared_ptr<Material>> & mats);
+  /**
+   * Reinit material properties for given element (and possible side)
+   * @param mats The materials to compute
+   * @param timings The per-object timings the materials are added to (optional)
+   * @param tid The thread computing the materials (only used for the timings)
+   */
+  void reinit(const std::vector<std::shared_ptr<Material>> & mats,
+              ObjectTimings * timings = nullptr,
+              THREAD_ID tid = 0);
 
   /// Calls the reset method of Materials to ensure that they are in a proper state.
   void reset(const std::vector<std::shared_ptr<Material>> & mats);
@@ -15,6 +15,7 @@
 #ifndef MATERIALPROPERTY_H
 #define MATERIALPROPERTY_H
 
+#include <memory>
 #include <vector>
 
 #include "MooseArray.h"
@@ -26,6 +27,7 @@
 #include "libmesh/vector_value.h"
 
 class PropertyValue;
+class PropertySlab;
 
 /**
  * Scalar Init helper routine so that specialization isn't needed for basic scalar MaterialProperty
@@ -59,6 +61,11 @@ public:
    */
   virtual PropertyValue * init(int size) = 0;
 
+  /**
+   * Create an empty slab that can store values of this property for many elements.
+   */
+  virtual PropertySlab * initSlab() = 0;
+
   virtual unsigned int size() const = 0;
 
   /**
@@ -130,6 +137,8 @@ public:
    */
   virtual PropertyValue * init(int size);
 
+  virtual PropertySlab * initSlab();
+
   /**
    * Resizes the property to the size n
    */
@@ -263,6 +272,164 @@ MaterialProperty<T>::load(std::istream & stream)
     loadHelper(stream, _value[i], NULL);
 }
 
+/**
+ * Abstract definition of a slab of property values.
+ *
+ * A slab stores the values of one property for many (element, side) pairs in large
+ * contiguous blocks of memory.  Each pair is assigned a "slot" holding one value per
+ * quadrature point.  The values of a slot are exposed as a MooseArray that can be swapped
+ * into a PropertyValue, so materials compute directly into the slab.
+ */
+class PropertySlab
+{
+public:
+  virtual ~PropertySlab() {}
+
+  /**
+   * Append a slot with n_qpoints values and return its index.
+   */
+  virtual unsigned int addSlot(unsigned int n_qpoints) = 0;
+
+  /**
+   * The number of slots in this slab.
+   */
+  virtual unsigned int nSlots() const = 0;
+
+  /**
+   * Swap the values of the given slot with the values held by rhs.
+   */
+  virtual void swap(unsigned int slot, PropertyValue * rhs) = 0;
+
+  /**
+   * Copy the value of a quadrature point of a slot of another slab of the same type.
+   *
+   * @param slot The slot in _this_ slab that you want to copy to.
+   * @param to_qp The quadrature point in that slot that you want to copy to.
+   * @param rhs The slab you want to copy _from_.
+   * @param from_slot The slot in rhs you want to copy _from_.
+   * @param from_qp The quadrature point in rhs you want to copy _from_.
+   */
+  virtual void qpCopy(unsigned int slot,
+                      const unsigned int to_qp,
+                      const PropertySlab & rhs,
+                      unsigned int from_slot,
+                      const unsigned int from_qp) = 0;
+
+  // save/restore the values of one slot in a file
+  virtual void store(unsigned int slot, std::ostream & stream) = 0;
+  virtual void load(unsigned int slot, std::istream & stream) = 0;
+};
+
+/**
+ * Concrete definition of a slab of property values for a specified type.
+ */
+template <typename T>
+class MaterialPropertySlab : public PropertySlab
+{
+public:
+  MaterialPropertySlab() : _block_size(0), _block_used(0) {}
+
+  /// The views do not own the blocks, but one resized in MaterialData owns its new memory
+  virtual ~MaterialPropertySlab()
+  {
+    for (auto & view : _views)
+      view.release();
+  }
+
+  virtual unsigned int addSlot(unsigned int n_qpoints) override;
+
+  virtual unsigned int nSlots() const override { return _views.size(); }
+
+  virtual void swap(unsigned int slot, PropertyValue * rhs) override;
+
+  virtual void qpCopy(unsigned int slot,
+                      const unsigned int to_qp,
+                      const PropertySlab & rhs,
+                      unsigned int from_slot,
+                      const unsigned int from_qp) override;
+
+  virtual void store(unsigned int slot, std::ostream & stream) override;
+
+  virtual void load(unsigned int slot, std::istream & stream) override;
+
+protected:
+  /// The blocks of values; they are never reallocated so the views into them stay valid
+  std::vector<std::unique_ptr<T[]>> _blocks;
+
+  /// Size of the last block
+  unsigned int _block_size;
+
+  /// Number of used values in the last block
+  unsigned int _block_used;
+
+  /// The values of each slot (these are swapped into the MaterialData while an element is computed)
+  std::vector<MooseArray<T>> _views;
+};
+
+template <typename T>
+inline unsigned int
+MaterialPropertySlab<T>::addSlot(unsigned int n_qpoints)
+{
+  if (_blocks.empty() || _block_used + n_qpoints > _block_size)
+  {
+    // Allocate room for many slots at once to amortize the allocations
+    const unsigned int min_block_size = 1024;
+    _block_size = std::max(n_qpoints, min_block_size);
+    _blocks.emplace_back(new T[_block_size]());
+    _block_used = 0;
+  }
+
+  _views.emplace_back();
+  _views.back().shallowCopy(_blocks.back().get() + _block_used, n_qpoints);
+  _block_used += n_qpoints;
+
+  return _views.size() - 1;
+}
+
+template <typename T>
+inline void
+MaterialPropertySlab<T>::swap(unsigned int slot, PropertyValue * rhs)
+{
+  mooseAssert(rhs != NULL, "Assigning NULL?");
+  mooseAssert(slot < _views.size(), "Invalid slot");
+  _views[slot].swap(cast_ptr<MaterialProperty<T> *>(rhs)->set());
+}
+
+template <typename T>
+inline void
+MaterialPropertySlab<T>::qpCopy(unsigned int slot,
+                                const unsigned int to_qp,
+                                const PropertySlab & rhs,
+                                unsigned int from_slot,
+                                const unsigned int from_qp)
+{
+  _views[slot][to_qp] =
+      static_cast<const MaterialPropertySlab<T> &>(rhs)._views[from_slot][from_qp];
+}
+
+template <typename T>
+inline void
+MaterialPropertySlab<T>::store(unsigned int slot, std::ostream & stream)
+{
+  for (unsigned int i = 0; i < _views[slot].size(); i++)
+    storeHelper(stream, _views[slot][i], NULL);
+}
+
+template <typename T>
+inline void
+MaterialPropertySlab<T>::load(unsigned int slot, std::istream & stream)
+{
+  for (unsigned int i = 0; i < _views[slot].size(); i++)
+    loadHelper(stream, _views[slot][i], NULL);
+}
+
+template <typename T>
+inline PropertySlab *
+MaterialProperty<T>::initSlab()
+{
+  return new MaterialPropertySlab<T>;
+}
+
 /**
  * Container for storing material properties
  */
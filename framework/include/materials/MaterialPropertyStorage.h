@@ -18,6 +18,9 @@
 #include "Moose.h"
 #include "MaterialProperty.h"
 #include "HashMap.h"
+#include "MooseError.h"
+
+#include "libmesh/elem.h"
 
 // Forward declarations
 class Material;
@@ -28,6 +31,7 @@ class QpMap;
 namespace libMesh
 {
 class QBase;
+class MeshBase;
 }
 
 /**
@@ -43,6 +47,32 @@ public:
 
   void releaseProperties();
 
+  /**
+   * Remove the stateful properties of an element that is about to be deleted, e.g. a child
+   * removed by mesh coarsening.  With slab storage its slots are reused for new elements.
+   */
+  void eraseProperty(const Elem * elem);
+
+  /**
+   * Rebuild the table giving the slab slots of the elements from their ids.  Must be called
+   * before the stateful properties are initialized and whenever the mesh changes, since the
+   * elements may have been renumbered.  Does nothing without slab storage.
+   */
+  void buildElemIndex(const MeshBase & mesh);
+
+  /**
+   * Select the storage backend for the stateful properties.  By default the values are kept
+   * per element in hash maps.  With slab storage the values of each property are kept in
+   * large contiguous blocks, one slot per element side, which avoids the per-element
+   * allocations.  Must be called before any property is stored.
+   */
+  void useSlabStorage(bool use_slabs);
+
+  /**
+   * @return a Boolean indicating whether the stateful properties are kept in slabs
+   */
+  bool usesSlabStorage() const { return _use_slabs; }
+
   /**
    * Creates storage for newly created elements from mesh Adaptivity.  Also, copies values from the
    * parent qps to the new children.
@@ -244,6 +274,14 @@ public:
     return _prop_names.count(retrievePropertyId(prop_name)) > 0;
   }
 
+  ///@{
+  /**
+   * Save/restore the slab storage (see useSlabStorage())
+   */
+  void storeSlabs(std::ostream & stream, void * context);
+  void loadSlabs(std::istream & stream, void * context);
+  ///@}
+
 protected:
   // indexing: [element][side]->material_properties
   HashMap<const Elem *, HashMap<unsigned int, MaterialProperties>> * _props_elem;
@@ -274,6 +312,50 @@ protected:
 
   void sizeProps(MaterialProperties & mp, unsigned int size);
 
+  /// Whether the stateful properties are kept in slabs rather than the hash maps above
+  bool _use_slabs;
+
+  ///@{
+  /// Slabs of the current, old and older stateful properties (indexed like
+  /// _stateful_prop_id_to_prop_id)
+  std::vector<std::unique_ptr<PropertySlab>> _slabs;
+  std::vector<std::unique_ptr<PropertySlab>> _slabs_old;
+  std::vector<std::unique_ptr<PropertySlab>> _slabs_older;
+  ///@}
+
+  /// Number of quadrature points in each slot of the slabs
+  std::vector<unsigned int> _slot_n_qpoints;
+
+  /// The element and side each slot of the slabs belongs to (nullptr for free slots and for the
+  /// slots of the elements no longer in the mesh)
+  std::vector<std::pair<const Elem *, unsigned int>> _slot_owners;
+
+  /// Offset of the sides of each element in _side_slots (indexed by element id)
+  std::vector<unsigned int> _elem_offsets;
+
+  /// Slot of each side of the indexed elements, _n_sides entries per element
+  std::vector<unsigned int> _side_slots;
+
+  /// Number of entries per element in _side_slots (the largest number of sides in the mesh)
+  unsigned int _n_sides;
+
+  /// Slots of the elements removed from the mesh (the coarsened children), by element and side.
+  /// These elements can't be dereferenced, their slots are kept until eraseProperty().
+  std::map<std::pair<const Elem *, unsigned int>, unsigned int> _detached_slots;
+
+  /// Slots released by eraseProperty(), by their number of quadrature points
+  std::map<unsigned int, std::vector<unsigned int>> _free_slots;
+
+  /// Return the slab slot of the element side, or libMesh::invalid_uint if there is none
+  unsigned int getSlot(const Elem & elem, unsigned int side) const
+  {
+    const dof_id_type id = elem.id();
+    if (id >= _elem_offsets.size() || _elem_offsets[id] == libMesh::invalid_uint)
+      return libMesh::invalid_uint;
+    mooseAssert(side < _n_sides, "Side out of range of the slot table");
+    return _side_slots[_elem_offsets[id] + side];
+  }
+
 private:
   /// Initializes hashmap entries for element and side to proper qpoint and
   /// property count sizes.
@@ -281,12 +363,27 @@ private:
                  const Elem & elem,
                  unsigned int side,
                  unsigned int n_qpoints);
+
+  /// Slab storage equivalent of initProps(), returns the slot of the element side
+  unsigned int initSlot(MaterialData & material_data,
+                        const Elem & elem,
+                        unsigned int side,
+                        unsigned int n_qpoints);
+
+  /// Swap the properties of MaterialData with the values of a slot of the slabs
+  void swapSlot(MaterialData & material_data, unsigned int slot);
 };
 
 template <>
 inline void
 dataStore(std::ostream & stream, MaterialPropertyStorage & storage, void * context)
 {
+  if (storage.usesSlabStorage())
+  {
+    storage.storeSlabs(stream, context);
+    return;
+  }
+
   dataStore(stream, storage.props(), context);
   dataStore(stream, storage.propsOld(), context);
 
@@ -298,6 +395,12 @@ template <>
 inline void
 dataLoad(std::istream & stream, MaterialPropertyStorage & storage, void * context)
 {
+  if (storage.usesSlabStorage())
+  {
+    storage.loadSlabs(stream, context);
+    return;
+  }
+
   dataLoad(stream, storage.props(), context);
   dataLoad(stream, storage.propsOld(), context);
 
@@ -53,6 +53,9 @@ protected:
 
   /// LinearInterpolation object
   std::unique_ptr<LinearInterpolation> _linear_interp;
+
+  /// Interval of the last lookup, the quadrature points of an element usually share it
+  unsigned int _interval_hint;
 };
 
 #endif // PIECEWISELINEARINTERPOLATIONMATERIAL_H
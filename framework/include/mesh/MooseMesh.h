@@ -22,6 +22,7 @@
 #include "MooseEnum.h"
 
 #include <memory> //std::unique_ptr
+#include <unordered_map>
 
 // libMesh
 #include "libmesh/mesh.h"
@@ -502,6 +503,18 @@ public:
    */
   const Node * addUniqueNode(const Point & p, Real tol = 1e-6);
 
+  /**
+   * Add a list of new nodes to the mesh, skipping every point that coincides (within tol)
+   * with an existing node or a point earlier in the list.  This is equivalent to calling
+   * addUniqueNode() for each point but sizes the internal spatial hash only once.
+   * @param points The points to add
+   * @param nodes Filled with the node located at each point
+   * @param tol Relative tolerance used to decide whether two points coincide
+   */
+  void addUniqueNodes(const std::vector<Point> & points,
+                      std::vector<const Node *> & nodes,
+                      Real tol = 1e-6);
+
   /**
    * Adds a fictitious "QuadratureNode".  This doesn't actually add it to the libMesh mesh...
    * we just keep track of these here in MooseMesh.
@@ -583,7 +596,8 @@ public:
   /**
    * This routine builds a multimap of boundary ids to matching boundary ids across all periodic
    * boundaries
-   * in the system.
+   * in the system. The nodes are matched by hashing their translated locations, no PointLocator is
+   * needed. On a distributed mesh this must be called on all processors.
    */
   void buildPeriodicNodeMap(std::multimap<dof_id_type, dof_id_type> & periodic_node_map,
                             unsigned int var_number,
@@ -983,6 +997,33 @@ protected:
   /// Vector of all the Nodes in the mesh for determining when to add a new point
   std::vector<Node *> _node_map;
 
+  /**
+   * Spatial hash over _node_map used by addUniqueNode(). Maps the (hashed) index of a
+   * cell of size _node_hash_cell_size to the positions in _node_map of the nodes inside it.
+   */
+  std::unordered_map<std::size_t, std::vector<unsigned int>> _node_hash;
+
+  /// Edge length of the cells in _node_hash
+  Real _node_hash_cell_size;
+
+  /// The tolerance _node_hash was sized for
+  Real _node_hash_tol;
+
+  /// (Re)build _node_map and _node_hash, sizing the cells for points up to max_l1_norm
+  void buildNodeHash(Real tol, Real max_l1_norm);
+
+  /// Return the node in _node_map that coincides with p, or nullptr if none does
+  Node * findUniqueNode(const Point & p, Real tol);
+
+  /// Add a new node at p to the mesh, _node_map and _node_hash
+  Node * insertUniqueNode(const Point & p);
+
+  /// Index of the _node_hash cell containing coordinate x
+  long int nodeHashCell(Real x) const;
+
+  /// Hash of the cell with the given indices
+  std::size_t nodeHashKey(long int i, long int j, long int k) const;
+
   /// Boolean indicating whether this mesh was detected to be regular and orthogonal
   bool _regular_orthogonal_mesh;
 
@@ -56,6 +56,11 @@ public:
    */
   Checkpoint(const InputParameters & parameters);
 
+  /**
+   * Class destructor, completes the checkpoint written in the background
+   */
+  virtual ~Checkpoint();
+
   /**
    * Outputs a checkpoint file.
    * Each call to this function creates various files associated with
@@ -86,6 +91,15 @@ private:
   /// True if outputing checkpoint files in binary format
   bool _binary;
 
+  /// True if the restartable data is written into one file per group of ranks
+  const bool _aggregated;
+
+  /// Number of ranks sharing a restartable data file when _aggregated is true
+  const unsigned int _ranks_per_file;
+
+  /// True if the aggregated restartable data is compressed
+  const bool _compress;
+
   /// True if running with parallel mesh
   bool _parallel_mesh;
 
@@ -26,6 +26,7 @@ class Exodus;
 namespace libMesh
 {
 class ExodusII_IO;
+class MeshBase;
 }
 
 template <>
@@ -42,6 +43,11 @@ public:
    */
   Exodus(const InputParameters & parameters);
 
+  /**
+   * Class destructor, completes the writes queued with 'async_write'
+   */
+  virtual ~Exodus();
+
   /**
    * Overload the OutputBase::output method, this is required for ExodusII
    * output due to the method utilized for outputing single/global parameters
@@ -111,6 +117,15 @@ protected:
    */
   virtual std::string filename() override;
 
+  /**
+   * Performs an operation on the ExodusII_IO object. The operation runs immediately unless
+   * 'async_write' is enabled, in which case it is queued and runs on the background writer with
+   * the staging systems, which hold no variables. Such an operation may only write data to the
+   * file: the values must be gathered beforehand and captured by value, since neither PETSc nor
+   * the libMesh objects of the simulation can be used off the main thread.
+   */
+  void exodusWrite(const std::function<void(ExodusII_IO &, const EquationSystems &)> & op);
+
   /// Pointer to the libMesh::ExodusII_IO object that performs the actual data output
   std::unique_ptr<ExodusII_IO> _exodus_io_ptr;
 
@@ -143,6 +158,18 @@ private:
    */
   void outputEmptyTimestep();
 
+  /**
+   * Creates the copy of the mesh that the queued writes read from, so that the simulation can
+   * continue to modify its own mesh while the data is written.
+   */
+  void initStaging();
+
+  /**
+   * Hands the operations collected by exodusWrite() during the current output to the background
+   * writer
+   */
+  void queueWrites();
+
   /// Count of outputs per exodus file
   unsigned int & _exodus_num;
 
@@ -160,6 +187,21 @@ private:
 
   /// Flag for overwriting timesteps
   bool _overwrite;
+
+  /// Whether the current ExodusII_IO object appends to an existing file
+  bool _exodus_append;
+
+  ///@{
+  /// The mesh and (empty) systems written by the background writer when 'async_write' is enabled
+  std::unique_ptr<MeshBase> _staging_mesh;
+  std::unique_ptr<EquationSystems> _staging_es;
+  ///@}
+
+  /// True if the mesh changed since the staging mesh was copied
+  bool _staging_mesh_changed;
+
+  /// The operations of the current output waiting to be queued (see exodusWrite())
+  std::vector<std::function<void(ExodusII_IO &, const EquationSystems &)>> _pending_writes;
 };
 
 #endif /* EXODUS_H */
@@ -17,6 +17,7 @@
 
 // MOOSE includes
 #include "PetscOutput.h"
+#include "BackgroundWriter.h"
 
 // Forward declerations
 class FileOutput;
@@ -70,7 +71,24 @@ public:
    */
   static std::string getOutputFileBase(MooseApp & app, std::string suffix = "_out");
 
+  /**
+   * Adds the 'async_write' and 'async_queue_depth' parameters, for the outputs that support
+   * writing on a background thread (see backgroundWriter())
+   */
+  static void addAsyncWriteParams(InputParameters & params);
+
+  /**
+   * Blocks until all of the writes queued on the background writer have completed
+   */
+  void flushWrites();
+
 protected:
+  /**
+   * Like flushWrites(), but a failed write is printed rather than reported with mooseError(),
+   * which must not happen in a destructor
+   */
+  void finishWrites();
+
   /**
    * Checks if the output method should be executed
    */
@@ -83,6 +101,13 @@ protected:
    */
   bool checkFilename();
 
+  /**
+   * The writer running queued writes on a background thread, created on first use. Outputs using
+   * it must call finishWrites() in their destructor since the queued writes usually refer to their
+   * members.
+   */
+  BackgroundWriter & backgroundWriter();
+
   /// The base filename from the input paramaters
   std::string _file_base;
 
@@ -95,7 +120,16 @@ protected:
   /// Storage for 'output_if_base_contains'
   std::vector<std::string> _output_if_base_contains;
 
+  /// True if the output should be written on a background thread (see addAsyncWriteParams())
+  const bool _async_write;
+
+  /// The maximum number of outputs waiting for the background writer
+  const unsigned int _async_queue_depth;
+
 private:
+  /// The background writer (see backgroundWriter())
+  std::unique_ptr<BackgroundWriter> _background_writer;
+
   // OutputWarehouse needs access to _file_num for MultiApp ninja wizardry (see
   // OutputWarehouse::merge)
   friend class OutputWarehouse;
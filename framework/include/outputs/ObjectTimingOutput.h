@@ -0,0 +1,54 @@
+/****************************************************************/
+/*               DO NOT MODIFY THIS HEADER                      */
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*           (c) 2010 Battelle Energy Alliance, LLC             */
+/*                   ALL RIGHTS RESERVED                        */
+/*                                                              */
+/*          Prepared by Battelle Energy Alliance, LLC           */
+/*            Under Contract No. DE-AC07-05ID14517              */
+/*            With the U. S. Department of Energy               */
+/*                                                              */
+/*            See COPYRIGHT for full restrictions               */
+/****************************************************************/
+
+#ifndef OBJECTTIMINGOUTPUT_H
+#define OBJECTTIMINGOUTPUT_H
+
+// MOOSE includes
+#include "BasicOutput.h"
+#include "FileOutput.h"
+
+// Forward declarations
+class ObjectTimingOutput;
+
+template <>
+InputParameters validParams<ObjectTimingOutput>();
+
+/**
+ * Writes the time spent in each Kernel, BC, Material, AuxKernel and UserObject (see
+ * ObjectTimings) to a JSON or CSV file, the most expensive objects first
+ */
+class ObjectTimingOutput : public BasicOutput<FileOutput>
+{
+public:
+  ObjectTimingOutput(const InputParameters & parameters);
+
+  /**
+   * Creates the output file name
+   * Appends the user-supplied 'file_base' input parameter with a '.json' or '.csv' extension
+   * @return A string containing the output filename
+   */
+  virtual std::string filename() override;
+
+  /**
+   * Write the timings
+   */
+  virtual void output(const ExecFlagType & type) override;
+
+protected:
+  /// The file format (json or csv)
+  const MooseEnum & _format;
+};
+
+#endif /* OBJECTTIMINGOUTPUT_H */
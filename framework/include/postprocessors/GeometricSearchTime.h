@@ -0,0 +1,37 @@
+/****************************************************************/
+/*               DO NOT MODIFY THIS HEADER                      */
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*           (c) 2010 Battelle Energy Alliance, LLC             */
+/*                   ALL RIGHTS RESERVED                        */
+/*                                                              */
+/*          Prepared by Battelle Energy Alliance, LLC           */
+/*            Under Contract No. DE-AC07-05ID14517              */
+/*            With the U. S. Department of Energy               */
+/*                                                              */
+/*            See COPYRIGHT for full restrictions               */
+/****************************************************************/
+
+#ifndef GEOMETRICSEARCHTIME_H
+#define GEOMETRICSEARCHTIME_H
+
+#include "PerformanceData.h"
+
+// Forward Declarations
+class GeometricSearchTime;
+
+template <>
+InputParameters validParams<GeometricSearchTime>();
+
+/**
+ * Reports the time spent in the nearest node search used by the contact and geometric search
+ * systems: either in rebuilding the master node patches of the slave nodes or in the whole
+ * search (which includes the patch rebuilds).
+ */
+class GeometricSearchTime : public PerformanceData
+{
+public:
+  GeometricSearchTime(const InputParameters & parameters);
+};
+
+#endif // GEOMETRICSEARCHTIME_H
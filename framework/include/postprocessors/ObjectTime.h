@@ -0,0 +1,50 @@
+/****************************************************************/
+/*               DO NOT MODIFY THIS HEADER                      */
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*           (c) 2010 Battelle Energy Alliance, LLC             */
+/*                   ALL RIGHTS RESERVED                        */
+/*                                                              */
+/*          Prepared by Battelle Energy Alliance, LLC           */
+/*            Under Contract No. DE-AC07-05ID14517              */
+/*            With the U. S. Department of Energy               */
+/*                                                              */
+/*            See COPYRIGHT for full restrictions               */
+/****************************************************************/
+
+#ifndef OBJECTTIME_H
+#define OBJECTTIME_H
+
+#include "GeneralPostprocessor.h"
+
+// Forward Declarations
+class ObjectTime;
+
+template <>
+InputParameters validParams<ObjectTime>();
+
+/**
+ * Reports the time spent in the compute methods of a Kernel, BC, Material, AuxKernel or
+ * UserObject, summed over all threads and processors (see ObjectTimings)
+ */
+class ObjectTime : public GeneralPostprocessor
+{
+public:
+  ObjectTime(const InputParameters & parameters);
+
+  virtual void initialize() override {}
+  virtual void execute() override {}
+  virtual Real getValue() override;
+
+protected:
+  /// The name of the object to report
+  const std::string & _object_name;
+
+  /// The loop the object is timed in ("all" for the sum over all loops)
+  const MooseEnum & _section;
+
+  /// The quantity to report
+  const MooseEnum & _value;
+};
+
+#endif // OBJECTTIME_H
@@ -19,12 +19,17 @@
 #include "DataIO.h"
 #include "Backup.h"
 
+// libMesh includes
+#include "libmesh/parallel.h"
+
 // C++ includes
 #include <sstream>
 #include <string>
 #include <list>
+#include <memory>
 
 // Forward declarations
+class BackgroundWriter;
 class RestartableDatas;
 class RestartableDataValue;
 class FEProblemBase;
@@ -39,7 +44,7 @@ class RestartableDataIO
 public:
   RestartableDataIO(FEProblemBase & fe_problem);
 
-  virtual ~RestartableDataIO() = default;
+  virtual ~RestartableDataIO();
 
   /**
    * Write out the restartable data.
@@ -48,6 +53,38 @@ public:
                             const RestartableDatas & restartable_datas,
                             std::set<std::string> & _recoverable_data);
 
+  /**
+   * Write out the restartable data of groups of ranks_per_file ranks into a single file per
+   * group (see aggregatedFileName()). The data of each rank and thread is gathered on the first
+   * rank of its group, which writes it as one chunk behind an index of chunk offsets so that
+   * every rank can seek directly to its own chunk on restart.
+   *
+   * The files are written under a temporary name (see aggregatedTempFileName()), which is created
+   * on every group before any file is renamed, so a checkpoint is complete once no temporary
+   * file is left (see MooseUtils::getRecoveryFileBase()).
+   *
+   * @param ranks_per_file Number of ranks sharing a file (0 puts all ranks in one file)
+   * @param compress Whether to compress each chunk (requires zlib)
+   * @param writer The writer the files are written by in the background, nullptr to write them
+   *               before returning
+   */
+  void writeAggregatedRestartableData(const std::string & base_file_name,
+                                      const RestartableDatas & restartable_datas,
+                                      unsigned int ranks_per_file,
+                                      bool compress,
+                                      BackgroundWriter * writer);
+
+  /**
+   * The name of the file holding the aggregated restartable data of the given group of ranks.
+   */
+  static std::string aggregatedFileName(const std::string & base_file_name, unsigned int group);
+
+  /**
+   * The name the aggregated file of the given group is written to before it is complete.
+   */
+  static std::string aggregatedTempFileName(const std::string & base_file_name,
+                                            unsigned int group);
+
   /**
    * Read restartable data header to verify that we are restarting on the correct number of
    * processors and threads.
@@ -86,6 +123,19 @@ private:
                              std::istream & stream,
                              const std::set<std::string> & recoverable_data);
 
+  /**
+   * Reads the header written by serializeRestartableData() and checks that it matches the
+   * current run.
+   */
+  void readRestartableDataHeader(std::istream & stream);
+
+  /**
+   * Reads the chunks of the current rank from the aggregated file of its group, one stream per
+   * thread, into _in_file_handles.
+   * @param ranks_per_file Number of ranks sharing a file, as read from the first file by rank 0
+   */
+  void readAggregatedChunks(const std::string & base_file_name, unsigned int ranks_per_file);
+
   /**
    * Serializes the data for the Systems in FEProblemBase
    */
@@ -99,8 +149,14 @@ private:
   /// Reference to a FEProblemBase being restarted
   FEProblemBase & _fe_problem;
 
-  /// A vector of file handles, one per thread
-  std::vector<std::shared_ptr<std::ifstream>> _in_file_handles;
+  /// A vector of input streams, one per thread
+  std::vector<std::shared_ptr<std::istream>> _in_file_handles;
+
+  /// Communicator of the ranks sharing an aggregated file, split once for _group_ranks_per_file
+  std::unique_ptr<Parallel::Communicator> _group_comm;
+
+  /// Number of ranks per file _group_comm was split for
+  unsigned int _group_ranks_per_file;
 };
 
 #endif /* RESTARTABLEDATAIO_H */
@@ -0,0 +1,101 @@
+/****************************************************************/
+/*               DO NOT MODIFY THIS HEADER                      */
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*           (c) 2010 Battelle Energy Alliance, LLC             */
+/*                   ALL RIGHTS RESERVED                        */
+/*                                                              */
+/*          Prepared by Battelle Energy Alliance, LLC           */
+/*            Under Contract No. DE-AC07-05ID14517              */
+/*            With the U. S. Department of Energy               */
+/*                                                              */
+/*            See COPYRIGHT for full restrictions               */
+/****************************************************************/
+
+#ifndef LUMPEDEXPLICITTVDRK2_H
+#define LUMPEDEXPLICITTVDRK2_H
+
+#include "TimeIntegrator.h"
+#include "MeshChangedInterface.h"
+
+class LumpedExplicitTVDRK2;
+
+template <>
+InputParameters validParams<LumpedExplicitTVDRK2>();
+
+/**
+ * Explicit TVD second-order Runge-Kutta time integration with a lumped
+ * (diagonal) mass matrix, see ExplicitTVDRK2 for the scheme:
+ *
+ *   Stage 1. U^{(1)} = U^n - dt*M_L^{-1}*R(t^n,U^n)
+ *
+ *   Stage 2. U^{n+1} = (U^n + U^{(1)})/2 - (dt/2)*M_L^{-1}*R(t^{n+1},U^{(1)})
+ *
+ * where R is the non-time residual and M_L is the lumped mass matrix.
+ *
+ * Since M_L is diagonal, each stage needs a single residual evaluation
+ * followed by vector updates: neither the nonlinear solver nor the
+ * linear solver is run and the Jacobian is never computed.  M_L is
+ * obtained from a residual evaluation of the time kernels alone with
+ * u_dot = 1, so that their residual is the row sum of the mass matrix.
+ * This is done once, and again whenever the mesh changes, so each stage
+ * only evaluates the non-time residual.  Everywhere else u_dot holds
+ * the actual rate of change.  This requires time kernels that are
+ * linear in u_dot with coefficients that do not depend on the solution
+ * (TimeDerivative, ODETimeDerivative) and every nonlinear variable to
+ * have one.  For CONSTANT MONOMIAL variables, as used by the finite
+ * volume rDG and CNSFV objects, M_L is the exact mass matrix and the
+ * results match ExplicitTVDRK2 with solve_type = LINEAR.
+ *
+ * As for ExplicitTVDRK2, the non-time Kernels, Materials, etc. must be
+ * marked "implicit=false", and the time kernels must not.  Use
+ * solve_type = LINEAR, otherwise the nonlinear system computes an
+ * unused initial residual every step.  NodalBCs are not supported,
+ * since they do not contribute to the residual through the mass matrix.
+ */
+class LumpedExplicitTVDRK2 : public TimeIntegrator, public MeshChangedInterface
+{
+public:
+  LumpedExplicitTVDRK2(const InputParameters & parameters);
+  virtual ~LumpedExplicitTVDRK2();
+
+  virtual int order() { return 2; }
+
+  virtual void initialSetup();
+  virtual void meshChanged();
+  virtual void computeTimeDerivatives();
+  virtual void solve();
+  virtual void postStep(NumericVector<Number> & residual);
+
+protected:
+  /**
+   * Evaluates the time kernels with u_dot = 1 and stores the inverse of
+   * the lumped mass matrix in _mass_inverse
+   * @return false if the residual evaluation failed
+   */
+  bool computeMassInverse();
+
+  /**
+   * Evaluates the residual at the current solution and stores
+   * M_L^{-1}*R in _stage_update
+   * @return false if the residual evaluation failed
+   */
+  bool computeStageUpdate();
+
+  /// Inverse of the lumped mass matrix
+  NumericVector<Number> & _mass_inverse;
+
+  /// M_L^{-1}*R of the current stage
+  NumericVector<Number> & _stage_update;
+
+  /// The current stage, 1 or 2
+  unsigned int _stage;
+
+  /// Whether the time kernels are being evaluated with u_dot = 1 for the lumped mass matrix
+  bool _computing_lumped_mass;
+
+  /// Whether M_L has to be assembled again, i.e. before the first stage and after mesh changes
+  bool _mass_needs_update;
+};
+
+#endif /* LUMPEDEXPLICITTVDRK2_H */
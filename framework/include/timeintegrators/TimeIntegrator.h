@@ -51,6 +51,12 @@ public:
   TimeIntegrator(const InputParameters & parameters);
   virtual ~TimeIntegrator();
 
+  /**
+   * Called from NonlinearSystemBase::initialSetup(), once all the objects
+   * of the simulation have been added
+   */
+  virtual void initialSetup() {}
+
   virtual void preSolve() {}
   virtual void preStep() {}
   virtual void solve();
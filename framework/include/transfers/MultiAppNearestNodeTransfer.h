@@ -17,6 +17,7 @@
 
 // MOOSE includes
 #include "MultiAppTransfer.h"
+#include "KDTree.h"
 
 // Forward declarations
 class MultiAppNearestNodeTransfer;
@@ -69,6 +70,18 @@ protected:
 
   void getLocalNodes(MooseMesh * mesh, std::vector<Node *> & local_nodes);
 
+  /**
+   * Build (or refresh) the KDTree over the local source nodes of each "from" problem.
+   * Trees are kept between executions and only refit or rebuilt when the source
+   * nodes have moved or changed.
+   * @param local_nodes The local source nodes of each "from" problem
+   * @param from_sys_nums The number of the system holding the source variable
+   * @param from_var_nums The number of the source variable in that system
+   */
+  void updateSearchTrees(const std::vector<std::vector<Node *>> & local_nodes,
+                         const std::vector<unsigned int> & from_sys_nums,
+                         const std::vector<unsigned int> & from_var_nums);
+
   AuxVariableName _to_var_name;
   VariableName _from_var_name;
 
@@ -87,6 +100,18 @@ protected:
   std::vector<std::vector<dof_id_type>> & _cached_dof_ids;
   std::map<dof_id_type, unsigned int> & _cached_from_inds;
   std::map<dof_id_type, unsigned int> & _cached_qp_inds;
+
+  /// Whether the nearest node is found with a KDTree rather than a linear scan
+  const bool _use_kdtree;
+
+  /// The maximum number of nodes in a KDTree leaf
+  const unsigned int _leaf_max_size;
+
+  /// One spatial index over the local source nodes for each local "from" problem
+  std::vector<std::unique_ptr<KDTree>> _search_trees;
+
+  /// The source dof of each point in _search_trees
+  std::vector<std::vector<dof_id_type>> _search_tree_dofs;
 };
 
 #endif /* MULTIAPPNEARESTNODETRANSFER_H */
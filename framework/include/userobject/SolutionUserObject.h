@@ -18,10 +18,14 @@
 // MOOSE includes
 #include "GeneralUserObject.h"
 
+// libMesh includes
+#include "libmesh/mesh_tools.h"
+
 // Forward declarations
 namespace libMesh
 {
 class ExodusII_IO;
+class ExodusII_IO_Helper;
 class EquationSystems;
 class System;
 class MeshFunction;
@@ -183,6 +187,39 @@ public:
   std::map<const Elem *, RealGradient>
   discontinuousPointValueGradient(Real t, Point pt, const unsigned int local_var_index) const;
 
+  /**
+   * Returns the values of a variable at a list of points (see pointValue). Unlike pointValue this
+   * does not lock, each thread evaluates its own copy of the data. The search for each point
+   * starts from the element containing the previous point, so points that are close to each other
+   * (e.g. the quadrature points of an element) should be passed in sequence.
+   * @param t The time at which to extract (not used, it is handled automatically when reading the
+   * data)
+   * @param points The locations at which to return values
+   * @param local_var_index The local index of the variable to be evaluated
+   * @param values Filled with the value of the variable at each point
+   * @param tid The thread evaluating the points
+   */
+  void pointValues(Real t,
+                   const std::vector<Point> & points,
+                   const unsigned int local_var_index,
+                   std::vector<Real> & values,
+                   THREAD_ID tid) const;
+
+  /**
+   * Returns the gradients of a variable at a list of points (see pointValues)
+   * @param t The time at which to extract (not used, it is handled automatically when reading the
+   * data)
+   * @param points The locations at which to return gradients
+   * @param local_var_index The local index of the variable to be evaluated
+   * @param gradients Filled with the gradient of the variable at each point
+   * @param tid The thread evaluating the points
+   */
+  void pointValueGradients(Real t,
+                           const std::vector<Point> & points,
+                           const unsigned int local_var_index,
+                           std::vector<RealGradient> & gradients,
+                           THREAD_ID tid) const;
+
   /**
    * Return a value directly from a Node
    * @param node A pointer to the node at which a value is desired
@@ -215,6 +252,15 @@ public:
 
   bool isVariableNodal(const std::string & var_name) const;
 
+  /// The number of elements of the mesh being read
+  dof_id_type numSourceElems() const;
+
+  /**
+   * The number of elements of the mesh being read that are kept on this processor, only a part of
+   * an ExodusII file is read with 'restrict_to_local_partition'
+   */
+  dof_id_type numLocalSourceElems() const;
+
   static MooseEnum weightingType()
   {
     return MooseEnum("found_first=1 average=2 smallest_element_id=4 largest_element_id=8",
@@ -235,6 +281,47 @@ protected:
    */
   void readExodusII();
 
+  /**
+   * Creates the system(s) holding the data of an ExodusII file on _mesh and reads the time step(s)
+   * currently needed into them
+   * @param nodal The nodal variables to read
+   * @param elemental The elemental variables to read
+   */
+  void buildExodusSystems(const std::vector<std::string> & nodal,
+                          const std::vector<std::string> & elemental);
+
+  /**
+   * Copies the variables of a system from a time step of the ExodusII file
+   * @param system The system to fill
+   * @param time_step The (one based) index of the time step to read
+   */
+  void copyExodusSolution(System & system, int time_step);
+
+  /**
+   * Reads the part of the mesh of an ExodusII file needed around the local elements of the
+   * problem mesh into _mesh, which only lives on this processor ('restrict_to_local_partition')
+   * @param problem_bbox The bounding box of the local elements, see localProblemBoundingBox()
+   */
+  void readLocalExodusMesh(const MeshTools::BoundingBox & problem_bbox);
+
+  /**
+   * Reads the values of the variables of a system on the part of the mesh read by
+   * readLocalExodusMesh()
+   * @param system The system to fill
+   * @param time_step The (one based) index of the time step to read
+   */
+  void readLocalExodusSolution(System & system, int time_step);
+
+  /**
+   * Whether the part of the mesh read by readLocalExodusMesh() holds all the (transformed) nodes
+   * and centroids of the local elements of the problem mesh that lie in the mesh of the file
+   * @param source_bbox The bounding box of the whole mesh of the file
+   */
+  bool localMeshCoversProblem(const MeshTools::BoundingBox & source_bbox) const;
+
+  /// Creates the copies of the solution(s) and the MeshFunctions that sample them
+  void initMeshFunctions();
+
   /**
    * Method for extracting value of solution based on the DOF,
    * this is called by the public overloaded function that accept
@@ -262,6 +349,48 @@ protected:
    */
   bool updateExodusBracketingTimeIndices(Real time);
 
+  /**
+   * Reads the variables of a single ExodusII time step into a system and its serialized solution
+   * @param system The system to fill
+   * @param serialized_solution The serial copy of the solution of the system
+   * @param time_index The (zero based) index of the time step to read
+   */
+  void readExodusTimeStep(System & system,
+                          NumericVector<Number> & serialized_solution,
+                          int time_index);
+
+  /// Swaps the data of the two time steps used for interpolation (including the MeshFunctions)
+  void swapInterpolationData();
+
+  /**
+   * Sizes the copy of the solution of a system read by the MeshFunctions and fills it: a full
+   * copy, or only the values needed near the local elements with 'restrict_to_local_partition'
+   */
+  void initSerializedSolution(System & system, NumericVector<Number> & serialized_solution);
+
+  /// Copies the solution of a system into the vector set up by initSerializedSolution()
+  void localizeSolution(System & system, NumericVector<Number> & serialized_solution);
+
+  /// Inflated bounding box of the local elements of the problem mesh
+  MeshTools::BoundingBox localProblemBoundingBox() const;
+
+  /**
+   * Sets _problem_bounding_box and the box it is mapped to in the mesh being read
+   * (_local_bounding_box)
+   * @param problem_bbox The bounding box of the local elements, see localProblemBoundingBox()
+   */
+  void setLocalBoundingBoxes(const MeshTools::BoundingBox & problem_bbox);
+
+  /**
+   * Finds the source dofs needed to sample the solution around the local elements of the problem
+   * mesh for 'restrict_to_local_partition' with a (fully read) XDA file
+   * @param problem_bbox The bounding box of the local elements, see localProblemBoundingBox()
+   */
+  void buildLocalDofs(const MeshTools::BoundingBox & problem_bbox);
+
+  /// Errors out if a (transformed) point is outside of the part of the solution kept locally
+  void checkLocalPoint(const Point & p) const;
+
   /**
    * A wrapper method for calling the various MeshFunctions used for reading the data
    * @param p The location at which data is desired
@@ -304,6 +433,26 @@ protected:
   std::map<const Elem *, RealGradient> evalMultiValuedMeshFunctionGradient(
       const Point & p, const unsigned int local_var_index, unsigned int func_num) const;
 
+  /**
+   * Maps a point of the simulation to the solution being read by applying all of the
+   * transformations (rotations, translation, scales) in the order given by 'transformation_order'
+   */
+  Point transformPoint(const Point & p) const
+  {
+    return _transformation_matrix * p + _transformation_offset;
+  }
+
+  /**
+   * Returns the copy of a MeshFunction used by a thread in pointValues() and
+   * pointValueGradients()
+   * @param func_num The MeshFunction index to use (1 = _mesh_function; 2 = _mesh_function2)
+   * @param tid The thread evaluating the MeshFunction
+   */
+  MeshFunction & threadMeshFunction(unsigned int func_num, THREAD_ID tid) const;
+
+  /// Reports an evaluation of the data outside of the mesh being read
+  void outOfMeshError(const Point & p, const unsigned int local_var_index) const;
+
   /// File type to read (0 = xda; 1 = ExodusII)
   MooseEnum _file_type;
 
@@ -331,6 +480,38 @@ protected:
   /// Flag for triggering interpolation of ExodusII data
   bool _interpolate_times;
 
+  /// Only keep the solution values needed around the local elements of the problem mesh
+  const bool _restrict_to_local_partition;
+
+  /// Bounding box of the local elements of the problem mesh (restrict_to_local_partition only)
+  MeshTools::BoundingBox _problem_bounding_box;
+
+  /// _problem_bounding_box mapped to the mesh being read, every sampled point lies in it
+  MeshTools::BoundingBox _local_bounding_box;
+
+  /// Source dofs owned by other processors that are sampled locally (XDA files)
+  std::vector<numeric_index_type> _local_dofs;
+
+  /// Communicator of this processor alone, the part of an ExodusII file read locally lives on it
+  Parallel::Communicator _local_communicator;
+
+  /// Reads the parts of an ExodusII file needed locally with 'restrict_to_local_partition'
+  std::unique_ptr<ExodusII_IO_Helper> _exodus_helper;
+
+  ///@{
+  /// The (zero based, sorted) indices of the nodes of the ExodusII file read locally and their
+  /// ids in _mesh
+  std::vector<dof_id_type> _local_nodes;
+  std::vector<dof_id_type> _local_node_ids;
+  ///@}
+
+  ///@{
+  /// For each block of the ExodusII file, the (zero based, sorted) indices in the block of the
+  /// elements read locally and their ids in _mesh
+  std::vector<std::vector<dof_id_type>> _local_block_elems;
+  std::vector<std::vector<dof_id_type>> _local_block_elem_ids;
+  ///@}
+
   /// Pointer the libmesh::mesh object
   std::unique_ptr<MeshBase> _mesh;
 
@@ -346,7 +527,7 @@ protected:
   /// Pointer to the libMesh::ExodusII used to read the files
   std::unique_ptr<ExodusII_IO> _exodusII_io;
 
-  /// Pointer to the serial solution vector
+  /// Pointer to the serial (or ghosted, see _local_dofs) solution vector
   std::unique_ptr<NumericVector<Number>> _serialized_solution;
 
   /// Pointer to second libMesh::EquationSystems object, used for interpolation
@@ -358,6 +539,12 @@ protected:
   /// Pointer to second libMesh::MeshFuntion, used for interpolation
   std::unique_ptr<MeshFunction> _mesh_function2;
 
+  ///@{
+  /// The copies of _mesh_function and _mesh_function2 owned by each thread
+  std::vector<std::unique_ptr<MeshFunction>> _thread_mesh_functions;
+  std::vector<std::unique_ptr<MeshFunction>> _thread_mesh_functions2;
+  ///@}
+
   /// Pointer to second serial solution, used for interpolation
   std::unique_ptr<NumericVector<Number>> _serialized_solution2;
 
@@ -406,6 +593,12 @@ protected:
   /// transformations (rotations, translation, scales) are performed in this order
   MultiMooseEnum _transformation_order;
 
+  ///@{
+  /// The affine map composed of all of the transformations (see transformPoint())
+  RealTensorValue _transformation_matrix;
+  RealVectorValue _transformation_offset;
+  ///@}
+
   /// True if initial_setup has executed
   bool _initialized;
 
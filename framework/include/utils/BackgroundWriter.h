@@ -0,0 +1,83 @@
+/****************************************************************/
+/*               DO NOT MODIFY THIS HEADER                      */
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*           (c) 2010 Battelle Energy Alliance, LLC             */
+/*                   ALL RIGHTS RESERVED                        */
+/*                                                              */
+/*          Prepared by Battelle Energy Alliance, LLC           */
+/*            Under Contract No. DE-AC07-05ID14517              */
+/*            With the U. S. Department of Energy               */
+/*                                                              */
+/*            See COPYRIGHT for full restrictions               */
+/****************************************************************/
+
+#ifndef BACKGROUNDWRITER_H
+#define BACKGROUNDWRITER_H
+
+// C++ includes
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <thread>
+
+/**
+ * Runs write operations in order on a single background thread so that output does not block
+ * the calling thread. The tasks must only touch data that the calling thread leaves alone until
+ * they have completed (see wait() and flush()).
+ *
+ * Exceptions thrown by a task are caught on the background thread and reported with mooseError()
+ * on the calling thread by the next call to wait() or flush().
+ */
+class BackgroundWriter
+{
+public:
+  BackgroundWriter();
+
+  /// Completes all of the queued tasks before stopping the background thread
+  ~BackgroundWriter();
+
+  /// Queues a task to be run on the background thread
+  void enqueue(std::function<void()> task);
+
+  /// Blocks until at most max_pending tasks are queued or running
+  void wait(unsigned int max_pending);
+
+  /// Blocks until all of the queued tasks have completed
+  void flush() { wait(0); }
+
+  /**
+   * Blocks until all of the queued tasks have completed and returns the error message of a failed
+   * task (empty if none) instead of reporting it, for use in destructors
+   */
+  std::string finish();
+
+private:
+  /// The loop run by the background thread
+  void run();
+
+  /// Blocks until at most max_pending tasks are queued or running and returns the error, if any
+  std::string waitForTasks(unsigned int max_pending);
+
+  std::thread _thread;
+  std::mutex _mutex;
+
+  /// Signaled when a task is queued or when the writer is stopped
+  std::condition_variable _task_queued;
+
+  /// Signaled when a task completes
+  std::condition_variable _task_done;
+
+  /// The queued tasks (the front task is removed once it completed)
+  std::deque<std::function<void()>> _tasks;
+
+  /// Set to stop the background thread once the queue is empty
+  bool _stop;
+
+  /// The error message of the first failed task
+  std::string _error;
+};
+
+#endif // BACKGROUNDWRITER_H
@@ -41,6 +41,9 @@ protected:
   /// Evaluate FParser object and check EvalError
   Real evaluate(ADFunctionPtr &);
 
+  /// Evaluate FParser object for the given parameters and check EvalError
+  Real evaluate(ADFunctionPtr &, const Real * params);
+
   /// add constants (which can be complex expressions) to the parser object
   void addFParserConstants(ADFunctionPtr & parser,
                            const std::vector<std::string> & constant_names,
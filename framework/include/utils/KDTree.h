@@ -0,0 +1,141 @@
+/****************************************************************/
+/*               DO NOT MODIFY THIS HEADER                      */
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*           (c) 2010 Battelle Energy Alliance, LLC             */
+/*                   ALL RIGHTS RESERVED                        */
+/*                                                              */
+/*          Prepared by Battelle Energy Alliance, LLC           */
+/*            Under Contract No. DE-AC07-05ID14517              */
+/*            With the U. S. Department of Energy               */
+/*                                                              */
+/*            See COPYRIGHT for full restrictions               */
+/****************************************************************/
+
+#ifndef KDTREE_H
+#define KDTREE_H
+
+// MOOSE includes
+#include "Moose.h" // using namespace libMesh
+
+// libMesh includes
+#include "libmesh/point.h"
+
+// C++ includes
+#include <array>
+#include <utility>
+#include <vector>
+
+/**
+ * A k-d tree over a fixed set of points that answers k-nearest-neighbor
+ * queries in O(log n) on average instead of the O(n) of a linear scan.
+ *
+ * The tree is built once from a list of points.  Query results are the
+ * indices of the points in the order in which they were passed to the
+ * constructor.  Ties in distance are broken by the lower index, so a query
+ * for the single nearest point returns the same point as a linear scan that
+ * keeps the first strictly closer candidate.
+ *
+ * Every tree node stores the bounding box of the points below it.  When the
+ * points move (e.g. on a displaced mesh) the boxes can be recomputed with
+ * refit(), which is linear in the number of points and keeps all queries
+ * exact; the tree only needs to be rebuilt if the motion is large enough to
+ * degrade its balance.
+ */
+class KDTree
+{
+public:
+  /**
+   * Build the tree.
+   * @param points The points to index.  They are copied into the tree.
+   * @param max_leaf_size The maximum number of points stored in a leaf.
+   */
+  KDTree(const std::vector<Point> & points, unsigned int max_leaf_size = 10);
+
+  /**
+   * Find the patch_size points closest to query_point.
+   * @param query_point The point to search around.
+   * @param patch_size The number of neighbors to return.
+   * @param return_index Filled with the indices of the neighbors, nearest first.
+   */
+  void neighborSearch(const Point & query_point,
+                      unsigned int patch_size,
+                      std::vector<std::size_t> & return_index) const;
+
+  /**
+   * Find the patch_size points closest to query_point.
+   * @param return_dist_sqr Filled with the squared distances of the neighbors.
+   */
+  void neighborSearch(const Point & query_point,
+                      unsigned int patch_size,
+                      std::vector<std::size_t> & return_index,
+                      std::vector<Real> & return_dist_sqr) const;
+
+  /**
+   * Return the index of the point closest to query_point.
+   * @param distance This will hold the distance between the returned point and query_point.
+   */
+  std::size_t nearest(const Point & query_point, Real & distance) const;
+
+  /**
+   * Move the indexed points to new locations and recompute the bounding boxes
+   * of the tree.  The topology of the tree is kept.
+   * @param points The new point locations, same size and order as in the constructor.
+   */
+  void refit(const std::vector<Point> & points);
+
+  /// The number of points in the tree
+  std::size_t size() const { return _points.size(); }
+
+  /// The point stored at the given (constructor) index
+  const Point & point(std::size_t i) const { return _points[i]; }
+
+protected:
+  struct TreeNode
+  {
+    /// Corners of the bounding box of all points below this node
+    std::array<Real, LIBMESH_DIM> _min, _max;
+
+    /// Range of _index covered by this node
+    std::size_t _begin, _end;
+
+    /// Children in _nodes (equal to invalid_node for a leaf)
+    std::size_t _left, _right;
+  };
+
+  /// Recursively build the subtree covering _index[begin, end) and return its node
+  std::size_t build(std::size_t begin, std::size_t end);
+
+  /// Recompute the bounding box of node and its children
+  void refitNode(std::size_t node);
+
+  /// Compute the bounding box of the points in _index[begin, end)
+  void computeBoundingBox(TreeNode & node) const;
+
+  /// Squared distance from p to the bounding box of node (zero if inside)
+  Real boxDistanceSqr(const Point & p, const TreeNode & node) const;
+
+  /// Candidate neighbors, kept as a max-heap on (squared distance, index)
+  typedef std::vector<std::pair<Real, std::size_t>> NeighborHeap;
+
+  void search(std::size_t node,
+              const Point & query_point,
+              unsigned int patch_size,
+              NeighborHeap & heap) const;
+
+  /// Copy of the indexed points
+  std::vector<Point> _points;
+
+  /// Permutation of the point indices, leaves own contiguous ranges of it
+  std::vector<std::size_t> _index;
+
+  /// Flat storage of the tree, the root is _nodes[0]
+  std::vector<TreeNode> _nodes;
+
+  /// Maximum number of points in a leaf
+  const unsigned int _max_leaf_size;
+
+  static const std::size_t invalid_node;
+};
+
+#endif // KDTREE_H
@@ -55,6 +55,19 @@ public:
    */
   Real sample(Real x) const;
 
+  /**
+   * Same as sample(x), but starts the interval search at the supplied hint and updates it with
+   * the interval containing x. Callers that sample close to their previous point (e.g. the
+   * quadrature points of an element or consecutive time steps) should keep one hint per thread.
+   */
+  Real sample(Real x, unsigned int & interval) const;
+
+  /**
+   * Samples all of the points in x and stores the results in y (resized as needed). The
+   * interval found for each point is used as the starting guess for the next one.
+   */
+  void sample(const std::vector<Real> & x, std::vector<Real> & y) const;
+
   /**
    * This function will take an independent variable input and will return the derivative of the
    * dependent variable
@@ -62,6 +75,11 @@ public:
    */
   Real sampleDerivative(Real x) const;
 
+  /**
+   * Same as sampleDerivative(x), but with an interval hint (see sample(x, interval))
+   */
+  Real sampleDerivative(Real x, unsigned int & interval) const;
+
   /**
    * This function will dump GNUPLOT input files that can be run to show the data points and
    * function fits
@@ -89,6 +107,13 @@ public:
   Real range(int i) const;
 
 private:
+  /**
+   * Returns the index i of the interval with _x[i] <= x < _x[i + 1]. x must lie inside of the
+   * table, std::out_of_range is thrown otherwise (e.g. for NaN). The interval passed in as the
+   * hint and its right neighbor are checked first before falling back to a binary search.
+   */
+  unsigned int findInterval(Real x, unsigned int hint) const;
+
   std::vector<Real> _x;
   std::vector<Real> _y;
 
@@ -25,19 +25,23 @@ public:
   /**
    * Default constructor.  Doesn't initialize anything.
    */
-  MooseArray() : _data(NULL), _size(0), _allocated_size(0) {}
+  MooseArray() : _data(NULL), _size(0), _allocated_size(0), _owns_data(true) {}
 
   /**
    * @param size The initial size of the array.
    */
-  explicit MooseArray(const unsigned int size) : _data(NULL), _allocated_size(0) { resize(size); }
+  explicit MooseArray(const unsigned int size)
+    : _data(NULL), _allocated_size(0), _owns_data(true)
+  {
+    resize(size);
+  }
 
   /**
    * @param size The initial size of the array.
    * @param default_value The default value to set.
    */
   explicit MooseArray(const unsigned int size, const T & default_value)
-    : _data(NULL), _allocated_size(0)
+    : _data(NULL), _allocated_size(0), _owns_data(true)
   {
     resize(size);
 
@@ -51,15 +55,17 @@ public:
   void setAllValues(const T & value);
 
   /**
-   * Manually deallocates the data pointer
+   * Manually deallocates the data pointer (memory owned by someone else is only forgotten)
    */
   void release()
   {
     if (_data != NULL)
     {
-      delete[] _data;
+      if (_owns_data)
+        delete[] _data;
       _data = NULL;
       _allocated_size = _size = 0;
+      _owns_data = true;
     }
   }
 
@@ -153,6 +159,16 @@ public:
    */
   void shallowCopy(std::vector<T> & rhs);
 
+  /**
+   * Doesn't actually make a copy of the data.
+   *
+   * Makes _this_ object operate on size entries of memory owned by someone else,
+   * starting at data.  The same warnings as for the other shallowCopy() methods apply.
+   * _this_ object never frees that memory: release() only forgets it, and resizing
+   * beyond size moves _this_ object to newly allocated memory of its own.
+   */
+  void shallowCopy(T * data, unsigned int size);
+
   /**
    * Actual operator=... really does make a copy of the data
    *
@@ -183,6 +199,9 @@ private:
 
   /// Number of allocated memory positions for storage.
   unsigned int _allocated_size;
+
+  /// Whether _data was allocated by this object (false for memory set by shallowCopy(T *, ...))
+  bool _owns_data;
 };
 
 template <typename T>
@@ -211,11 +230,12 @@ MooseArray<T>::resize(const unsigned int size)
     T * new_pointer = new T[size];
     mooseAssert(new_pointer, "Failed to allocate MooseArray memory!");
 
-    if (_data != NULL)
+    if (_data != NULL && _owns_data)
       delete[] _data;
     _data = new_pointer;
     _allocated_size = size;
     _size = size;
+    _owns_data = true;
   }
 }
 
@@ -232,11 +252,13 @@ MooseArray<T>::resize(const unsigned int size, const T & default_value)
     {
       for (unsigned int i = 0; i < _size; i++)
         new_pointer[i] = _data[i];
-      delete[] _data;
+      if (_owns_data)
+        delete[] _data;
     }
 
     _data = new_pointer;
     _allocated_size = size;
+    _owns_data = true;
   }
 
   for (unsigned int i = _size; i < size; i++)
@@ -277,6 +299,7 @@ MooseArray<T>::swap(MooseArray & rhs)
   std::swap(_data, rhs._data);
   std::swap(_size, rhs._size);
   std::swap(_allocated_size, rhs._allocated_size);
+  std::swap(_owns_data, rhs._owns_data);
 }
 
 template <typename T>
@@ -286,6 +309,7 @@ MooseArray<T>::shallowCopy(const MooseArray & rhs)
   _data = rhs._data;
   _size = rhs._size;
   _allocated_size = rhs._allocated_size;
+  _owns_data = rhs._owns_data;
 }
 
 template <typename T>
@@ -297,6 +321,16 @@ MooseArray<T>::shallowCopy(std::vector<T> & rhs)
   _allocated_size = rhs.size();
 }
 
+template <typename T>
+inline void
+MooseArray<T>::shallowCopy(T * data, unsigned int size)
+{
+  _data = data;
+  _size = size;
+  _allocated_size = size;
+  _owns_data = false;
+}
+
 template <typename T>
 inline MooseArray<T> &
 MooseArray<T>::operator=(const std::vector<T> & rhs)
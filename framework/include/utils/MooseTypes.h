@@ -229,11 +229,12 @@ enum PCSideType
  */
 enum SolveType
 {
-  ST_PJFNK,  ///< Preconditioned Jacobian-Free Newton Krylov
-  ST_JFNK,   ///< Jacobian-Free Newton Krylov
-  ST_NEWTON, ///< Full Newton Solve
-  ST_FD,     ///< Use finite differences to compute Jacobian
-  ST_LINEAR  ///< Solving a linear problem
+  ST_PJFNK,      ///< Preconditioned Jacobian-Free Newton Krylov
+  ST_JFNK,       ///< Jacobian-Free Newton Krylov
+  ST_NEWTON,     ///< Full Newton Solve
+  ST_FD,         ///< Use finite differences to compute Jacobian
+  ST_LINEAR,     ///< Solving a linear problem
+  ST_MATRIX_FREE ///< Newton Krylov with the element Jacobians applied without assembling them
 };
 
 /**
@@ -318,6 +318,7 @@ std::list<std::string> getFilesInDirs(const std::list<std::string> & directory_l
 
 /**
  * Returns the most recent checkpoint file given a list of files.
+ * Checkpoints without complete restartable data are skipped.
  * If a suitable file isn't found the empty string is returned
  * @param checkpoint_files the list of files to analyze
  */
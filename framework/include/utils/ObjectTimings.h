@@ -0,0 +1,137 @@
+/****************************************************************/
+/*               DO NOT MODIFY THIS HEADER                      */
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*           (c) 2010 Battelle Energy Alliance, LLC             */
+/*                   ALL RIGHTS RESERVED                        */
+/*                                                              */
+/*          Prepared by Battelle Energy Alliance, LLC           */
+/*            Under Contract No. DE-AC07-05ID14517              */
+/*            With the U. S. Department of Energy               */
+/*                                                              */
+/*            See COPYRIGHT for full restrictions               */
+/****************************************************************/
+
+#ifndef OBJECTTIMINGS_H
+#define OBJECTTIMINGS_H
+
+#include "MooseTypes.h"
+
+#include "libmesh/parallel.h"
+
+#include <array>
+#include <chrono>
+#include <unordered_map>
+
+class MooseObject;
+
+/**
+ * Accumulates the time spent in the compute methods of individual objects (Kernels, BCs,
+ * Materials, AuxKernels and UserObjects) inside the threaded loops. Every thread has its own
+ * accumulators so timing does not lock. Timing is off until an object reporting the timings
+ * (ObjectTimingOutput or ObjectTime) enables it.
+ */
+class ObjectTimings
+{
+public:
+  /// The loops the objects are timed in
+  enum Section
+  {
+    RESIDUAL = 0,
+    JACOBIAN,
+    MATERIAL,
+    AUXILIARY,
+    USER_OBJECT,
+    NUM_SECTIONS
+  };
+
+  /// The time accumulated by one object in one section
+  struct Entry
+  {
+    std::string section;
+    std::string name;
+    std::string type;
+    Real time;
+    unsigned long int calls;
+  };
+
+  ObjectTimings();
+
+  /// Turns the timing on
+  void enable() { _enabled = true; }
+
+  /// Whether objects are being timed
+  bool enabled() const { return _enabled; }
+
+  /// Adds the time of one call of an object to the accumulators of a thread
+  void add(const MooseObject & object, Section section, Real time, THREAD_ID tid)
+  {
+    Accumulator & accumulator = _thread_data[tid][section][&object];
+    accumulator.time += time;
+    accumulator.calls++;
+  }
+
+  /**
+   * Sums the accumulators of all threads and processors. This is collective, the entries are
+   * sorted by decreasing time.
+   */
+  std::vector<Entry> gather(const Parallel::Communicator & comm) const;
+
+  /// Clears the accumulated times
+  void reset();
+
+  /// The name of a section used in the reports
+  static std::string sectionName(Section section);
+
+  /**
+   * Times the lifetime of this object and adds it to the accumulators, this does nothing when
+   * timing is disabled
+   */
+  class ScopedTimer
+  {
+  public:
+    ScopedTimer(ObjectTimings & timings, const MooseObject & object, Section section, THREAD_ID tid)
+      : _timings(timings.enabled() ? &timings : nullptr),
+        _object(object),
+        _section(section),
+        _tid(tid)
+    {
+      if (_timings)
+        _start = std::chrono::steady_clock::now();
+    }
+
+    ~ScopedTimer()
+    {
+      if (_timings)
+        _timings->add(
+            _object,
+            _section,
+            std::chrono::duration<Real>(std::chrono::steady_clock::now() - _start).count(),
+            _tid);
+    }
+
+  private:
+    ObjectTimings * const _timings;
+    const MooseObject & _object;
+    const Section _section;
+    const THREAD_ID _tid;
+    std::chrono::steady_clock::time_point _start;
+  };
+
+private:
+  struct Accumulator
+  {
+    Accumulator() : time(0), calls(0) {}
+
+    Real time;
+    unsigned long int calls;
+  };
+
+  bool _enabled;
+
+  /// The accumulators of each thread, by section and object
+  std::vector<std::array<std::unordered_map<const MooseObject *, Accumulator>, NUM_SECTIONS>>
+      _thread_data;
+};
+
+#endif // OBJECTTIMINGS_H
@@ -359,15 +359,16 @@ public:
    * @param calculation_type If "N" then calculation eigenvalues only
    * @param eigvals Eigenvalues are placed in this array, in ascending order
    * @param a Eigenvectors are placed in this array if calculation_type == "V".
-   * See code in dsymmetricEigenvalues for extracting eigenvectors from the a output.
+   * a[i * N + j] is the j-th component of the i-th eigenvector.
+   * The eigen methods above do not call this; it is kept as a LAPACK reference.
    */
   void syev(const char * calculation_type,
             std::vector<PetscScalar> & eigvals,
             std::vector<PetscScalar> & a) const;
 
   /**
-   * Uses the petscblaslapack.h LAPACKsyev_ routine to perform RU decomposition and obtain the
-   * rotation tensor.
+   * Performs the RU decomposition and obtains the rotation tensor, using the eigenvalues and
+   * eigenvectors of C = A^T A.
    */
   void getRUDecompositionRotation(RankTwoTensor & rot) const;
 
@@ -409,6 +410,14 @@ private:
   static const unsigned int N = LIBMESH_DIM;
   Real _vals[N][N];
 
+  /**
+   * Computes the eigenvalues, and optionally the eigenvectors, of the symmetric part of this
+   * tensor using cyclic Jacobi rotations
+   * @param eigvals Eigenvalues are placed in this array, in ascending order
+   * @param eigvecs If not NULL, eigvecs[i] is set to the unit eigenvector of eigvals[i]
+   */
+  void jacobiEigen(Real eigvals[N], Real (*eigvecs)[N]) const;
+
   template <class T>
   friend void dataStore(std::ostream &, T &, void *);
 
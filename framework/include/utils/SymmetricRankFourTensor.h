@@ -0,0 +1,182 @@
+/****************************************************************/
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*          All contents are licensed under LGPL V2.1           */
+/*             See LICENSE for full restrictions                */
+/****************************************************************/
+#ifndef SYMMETRICRANKFOURTENSOR_H
+#define SYMMETRICRANKFOURTENSOR_H
+
+// MOOSE includes
+#include "Moose.h"
+#include "DerivativeMaterialInterface.h"
+#include "RankFourTensor.h"
+
+// libMesh includes
+#include "libmesh/libmesh.h"
+
+class RankTwoTensor;
+class SymmetricRankFourTensor;
+
+/**
+ * Helper function template specialization to set an object to zero.
+ * Needed by DerivativeMaterialInterface
+ */
+template <>
+void mooseSetToZero<SymmetricRankFourTensor>(SymmetricRankFourTensor & v);
+
+/**
+ * SymmetricRankFourTensor holds a fourth order tensor C with the minor symmetries
+ * C_ijkl = C_jikl = C_ijlk, which is the case for elasticity tensors and most
+ * stress-strain tangent operators.
+ *
+ * The tensor is stored as a 6x6 matrix in Mandel notation, with the index pairs
+ * (11, 22, 33, 23, 13, 12) and the shear rows and columns scaled by sqrt(2):
+ *   M_ab = w_a w_b C_ijkl,   w = (1, 1, 1, sqrt(2), sqrt(2), sqrt(2))
+ * In this form a double contraction with a symmetric rank-two tensor is a 6x6
+ * matrix-vector product, the contraction of two such tensors is a 6x6 matrix
+ * product, invSymm is a 6x6 matrix inverse and rotation is M -> Q M Q^T with an
+ * orthogonal 6x6 matrix Q.  This needs 36 instead of 81 entries and much shorter
+ * fixed-size loops than RankFourTensor.  Major symmetry C_ijkl = C_klij is not
+ * assumed, so non-associative tangent operators can also be stored.
+ */
+class SymmetricRankFourTensor
+{
+public:
+  /// Initialization method
+  enum InitMethod
+  {
+    initNone,
+    initIdentitySymmetricFour
+  };
+
+  /// Number of independent index pairs
+  static const unsigned int N = 6;
+
+  /// Default constructor; fills to zero
+  SymmetricRankFourTensor();
+
+  /// Select specific initialization pattern
+  SymmetricRankFourTensor(const InitMethod);
+
+  /// Fill from vector, see RankFourTensor::fillFromInputVector
+  SymmetricRankFourTensor(const std::vector<Real> & input, RankFourTensor::FillMethod fill_method);
+
+  /**
+   * Conversion from a full RankFourTensor, which is assumed to satisfy
+   * C_ijkl = C_jikl = C_ijlk
+   */
+  explicit SymmetricRankFourTensor(const RankFourTensor & a);
+
+  /// Conversion to a full RankFourTensor
+  RankFourTensor toRankFourTensor() const;
+
+  /// Gets the value of C_ijkl.  Takes index = 0,1,2
+  Real operator()(unsigned int i, unsigned int j, unsigned int k, unsigned int l) const;
+
+  /// Sets C_ijkl, and hence C_jikl, C_ijlk and C_jilk, to value.  Takes index = 0,1,2
+  void set(unsigned int i, unsigned int j, unsigned int k, unsigned int l, Real value);
+
+  /// Gets the Mandel component M_ab.  Takes index = 0,...,5
+  Real & mandel(unsigned int a, unsigned int b) { return _vals[a][b]; }
+
+  /// Gets the Mandel component M_ab.  Takes index = 0,...,5
+  Real mandel(unsigned int a, unsigned int b) const { return _vals[a][b]; }
+
+  /// Zeros out the tensor.
+  void zero();
+
+  /// Print the tensor in Mandel notation
+  void print(std::ostream & stm = Moose::out) const;
+
+  /// C_ijkl*a_kl, using the symmetric part of a
+  RankTwoTensor operator*(const RankTwoTensor & a) const;
+
+  /// C_ijkl*a
+  SymmetricRankFourTensor operator*(const Real a) const;
+
+  /// C_ijkl *= a
+  SymmetricRankFourTensor & operator*=(const Real a);
+
+  /// C_ijkl/a
+  SymmetricRankFourTensor operator/(const Real a) const;
+
+  /// C_ijkl /= a  for all i, j, k, l
+  SymmetricRankFourTensor & operator/=(const Real a);
+
+  /// C_ijkl += a_ijkl  for all i, j, k, l
+  SymmetricRankFourTensor & operator+=(const SymmetricRankFourTensor & a);
+
+  /// C_ijkl + a_ijkl
+  SymmetricRankFourTensor operator+(const SymmetricRankFourTensor & a) const;
+
+  /// C_ijkl -= a_ijkl
+  SymmetricRankFourTensor & operator-=(const SymmetricRankFourTensor & a);
+
+  /// C_ijkl - a_ijkl
+  SymmetricRankFourTensor operator-(const SymmetricRankFourTensor & a) const;
+
+  /// -C_ijkl
+  SymmetricRankFourTensor operator-() const;
+
+  /// C_ijpq*a_pqkl
+  SymmetricRankFourTensor operator*(const SymmetricRankFourTensor & a) const;
+
+  /// sqrt(C_ijkl*C_ijkl)
+  Real L2norm() const;
+
+  /**
+   * This returns A_ijkl such that C_ijkl*A_klmn = 0.5*(de_im de_jn + de_in de_jm)
+   */
+  SymmetricRankFourTensor invSymm() const;
+
+  /**
+   * Rotate the tensor using
+   * C_ijkl = R_im R_jn R_ko R_lp C_mnop
+   */
+  void rotate(const RankTwoTensor & R);
+
+  /**
+   * Transpose the tensor by swapping the first pair with the second pair of indices
+   * @return C_klij
+   */
+  SymmetricRankFourTensor transposeMajor() const;
+
+  /// Inner product of the major transposed tensor with a rank two tensor, a_ij*C_ijkl
+  RankTwoTensor innerProductTranspose(const RankTwoTensor & a) const;
+
+  /// Calculates the sum of Ciijj for i and j varying from 0 to 2
+  Real sum3x3() const;
+
+protected:
+  /// The Mandel components of the tensor
+  Real _vals[N][N];
+
+  /// Mandel index pair (i, j) of the Mandel index a
+  static const unsigned int _pair[N][2];
+
+  /// Mandel index of the index pair (i, j)
+  static const unsigned int _index[3][3];
+
+  /// Mandel weights, 1 for the normal and sqrt(2) for the shear components
+  static const Real _weight[N];
+
+  template <class T>
+  friend void dataStore(std::ostream &, T &, void *);
+
+  template <class T>
+  friend void dataLoad(std::istream &, T &, void *);
+};
+
+template <>
+void dataStore(std::ostream &, SymmetricRankFourTensor &, void *);
+
+template <>
+void dataLoad(std::istream &, SymmetricRankFourTensor &, void *);
+
+inline SymmetricRankFourTensor operator*(Real a, const SymmetricRankFourTensor & b)
+{
+  return b * a;
+}
+
+#endif // SYMMETRICRANKFOURTENSOR_H
@@ -47,6 +47,15 @@ protected:
 
   /// maximum derivative order
   unsigned int _derivative_order;
+
+  /// The parameters of all quadrature points of the current element (one _func_params per qp)
+  std::vector<Real> _qp_params;
+
+  /// The quadrature points with distinct parameters (the functions are evaluated at these only)
+  std::vector<unsigned int> _unique_qps;
+
+  /// For each quadrature point the quadrature point in _unique_qps with the same parameters
+  std::vector<unsigned int> _qp_source;
 };
 
 struct DerivativeParsedMaterialHelper::QueueItem
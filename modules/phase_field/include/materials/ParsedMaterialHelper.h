@@ -54,6 +54,14 @@ protected:
   // run FPOptimizer on the parsed function
   virtual void functionsOptimize();
 
+  /**
+   * Optionally take the derivative of the parser w.r.t. variable, then optimize and JIT compile it.
+   * While loading the byte code broadcast from processor 0 the derivative and the optimization
+   * are skipped and the next serialized byte code is used instead.
+   * @return false if the derivative could not be taken
+   */
+  bool optimizeFunction(ADFunctionPtr & parser, const std::string & variable = "");
+
   /// The undiffed free energy function parser object.
   ADFunctionPtr _func_F;
 
@@ -76,6 +84,18 @@ protected:
    * parsing the FParser expression.
    */
   const VariableNameMappingMode _map_mode;
+
+  /// serialized optimized byte code of all parsers (in the order they are optimized)
+  std::vector<std::string> _shared_byte_code;
+
+  /// record the optimized byte code into _shared_byte_code (on processor 0)
+  bool _record_byte_code;
+
+  /// load the optimized byte code from _shared_byte_code (on all other processors)
+  bool _load_byte_code;
+
+  /// index of the next entry in _shared_byte_code to load
+  std::size_t _next_byte_code;
 };
 
 #endif // PARSEDMATERIALHELPER_H
@@ -11,6 +11,7 @@
 #include "GeneralPostprocessor.h"
 #include "InfixIterator.h"
 #include "MooseVariableDependencyInterface.h"
+#include "SortedIdSet.h"
 #include "ZeroInterface.h"
 
 #include <iterator>
@@ -230,17 +231,17 @@ public:
     friend std::ostream & operator<<(std::ostream & out, const FeatureData & feature);
 
     /// Holds the ghosted ids for a feature (the ids which will be used for stitching
-    std::set<dof_id_type> _ghosted_ids;
+    SortedIdSet _ghosted_ids;
 
     /// Holds the local ids in the interior of a feature.
     /// This data structure is only maintained on the local processor
-    std::set<dof_id_type> _local_ids;
+    SortedIdSet _local_ids;
 
     /// Holds the ids surrounding the feature
-    std::set<dof_id_type> _halo_ids;
+    SortedIdSet _halo_ids;
 
     /// Holds the nodes that belong to the feature on a periodic boundary
-    std::set<dof_id_type> _periodic_nodes;
+    SortedIdSet _periodic_nodes;
 
     /// The Moose variable where this feature was found (often the "order parameter")
     std::size_t _var_index;
@@ -375,12 +376,55 @@ protected:
    */
   void mergeSets(bool use_periodic_boundary_info);
 
+  /**
+   * Stitches together the partial features in feature_sets that share ghosted entities (or
+   * periodic nodes). The merged features are left in feature_sets.
+   */
+  void stitchPartialFeatures(std::vector<std::list<FeatureData>> & feature_sets,
+                             bool use_periodic_boundary_info);
+
+  /**
+   * Moves the active merged features from feature_sets into the flat _feature_sets vector,
+   * averages their centroids and updates the feature counts.
+   */
+  void consolidateMergedFeatures(std::vector<std::list<FeatureData>> & feature_sets);
+
   /**
    * This routine handles all of the serialization, communication and deserialization of the data
    * structures containing FeatureData objects.
    */
   void communicateAndMerge();
 
+  /**
+   * Stitches the partial features together without gathering them on the root
+   * ("merge_method = DISTRIBUTED"). Connections between pieces are found by sending their ghosted
+   * and periodic ids to a rendezvous processor and are collected in a union-find that is reduced up
+   * a binary tree of processors. Each feature is then merged on the processor holding the piece
+   * with the smallest key (the representative of its set).
+   *
+   * @param merged_sets Filled with the merged features owned by this processor
+   * @param local_roots Filled with the key of the feature each local piece belongs to (indexed by
+   *                    the local index of the piece)
+   *
+   * _partial_feature_sets still holds the local pieces after this call.
+   */
+  void distributedMerge(std::vector<std::list<FeatureData>> & merged_sets,
+                        std::vector<std::size_t> & local_roots);
+
+  /**
+   * Assigns the same ids sortAndLabel() would to the features from distributedMerge() and updates
+   * the local pieces with them. Only the sort key of each feature is communicated.
+   */
+  void labelDistributedFeatures(std::vector<std::list<FeatureData>> & merged_sets,
+                                const std::vector<std::size_t> & local_roots);
+
+  /**
+   * Sends send_data[i] to processor i and fills recv_data[i] with the data received from
+   * processor i. Empty containers are not sent.
+   */
+  template <typename T>
+  void exchangeData(std::vector<T> & send_data, std::vector<T> & recv_data);
+
   /**
    * Sort and assign ids to features based on their position in the container after sorting.
    */
@@ -393,6 +437,12 @@ protected:
    */
   void scatterAndUpdateRanks();
 
+  /**
+   * Moves the local pieces from _partial_feature_sets into _feature_sets at their local index and
+   * assigns them their global ids from _local_to_global_feature_map. Returns the largest global id.
+   */
+  std::size_t updateLocalFeatureIds();
+
   /**
    * This routine populates a stacked vector of local to global indices per rank and the associated
    * count vector for scattering the vector to the ranks. The individual vectors can be different
@@ -506,6 +556,9 @@ protected:
    */
   const bool _use_less_than_threshold_comparison;
 
+  /// Whether the partial features are stitched together in parallel instead of on the root
+  const bool _distributed_merge;
+
   // Convenience variable holding the number of variables coupled into this object
   const std::size_t _n_vars;
 
@@ -600,6 +653,9 @@ protected:
 
   /// Convenience variable for testing master rank
   bool _is_master;
+
+  /// Set when the features were labelled without the root holding all of them
+  bool _distributed_labels;
 };
 
 template <>
@@ -8,6 +8,7 @@
 #ifndef GRAINTRACKER_H
 #define GRAINTRACKER_H
 
+#include "BoundingBoxIndex.h"
 #include "FeatureFloodCount.h"
 #include "GrainTrackerInterface.h"
 
@@ -147,6 +148,22 @@ protected:
                                 std::vector<std::map<Node *, CacheValues>> & cache,
                                 RemapCacheMode cache_mode);
 
+  /**
+   * Fills a spatial index with the bounding boxes of all grains in _feature_sets. The items in
+   * the index are the grain indices.
+   */
+  void buildBoundingBoxIndex(BoundingBoxIndex & bbox_index) const;
+
+  /**
+   * Fills candidates with the (ascending) indices of the grains in _feature_sets on the same
+   * variable as the given grain that may intersect it. In incremental mode only the grains with
+   * intersecting bounding boxes are returned (bbox_index must be built), otherwise all grains on
+   * the same variable are returned.
+   */
+  void findGrainCandidates(const FeatureData & grain,
+                           const BoundingBoxIndex & bbox_index,
+                           std::vector<std::size_t> & candidates) const;
+
   /**
    * This method returns the minimum periodic distance between two vectors of bounding boxes. If the
    * bounding boxes overlap the result is always -1.0.
@@ -208,6 +225,9 @@ protected:
   /// Inidicates whether remapping should be done or not (remapping is independent of tracking)
   const bool _remap;
 
+  /// Indicates whether grains are only compared to the grains with intersecting bounding boxes
+  const bool _incremental_tracking;
+
   /// A reference to the nonlinear system (used for retrieving solution vectors)
   NonlinearSystemBase & _nl;
 
@@ -0,0 +1,68 @@
+/****************************************************************/
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*          All contents are licensed under LGPL V2.1           */
+/*             See LICENSE for full restrictions                */
+/****************************************************************/
+#ifndef BOUNDINGBOXINDEX_H
+#define BOUNDINGBOXINDEX_H
+
+#include "MooseTypes.h"
+
+// libMesh includes
+#include "libmesh/mesh_tools.h"
+
+#include <vector>
+
+/**
+ * A uniform grid over a collection of bounding boxes used to find the boxes that
+ * intersect a given box without comparing against every box in the collection.
+ * Each box is registered in every cell it overlaps; a query gathers the items from
+ * the cells overlapped by the query box and keeps those whose boxes really intersect.
+ *
+ * Items are identified by an index supplied by the caller and may own several boxes
+ * (e.g. the pieces of a feature split by a periodic boundary).
+ */
+class BoundingBoxIndex
+{
+public:
+  BoundingBoxIndex();
+
+  /// Removes all boxes from the index
+  void clear();
+
+  /// Registers a box belonging to the item with the given index. Call build() afterwards.
+  void addBox(std::size_t item, const MeshTools::BoundingBox & bbox);
+
+  /// Sizes the grid from the registered boxes and bins them into cells
+  void build();
+
+  /**
+   * Fills items with the (sorted, unique) indices of the items that own a box intersecting
+   * any of the query boxes. Intersection uses the same closed-interval test as
+   * BoundingBox::intersects so the result matches a brute force search.
+   */
+  void query(const std::vector<MeshTools::BoundingBox> & bboxes,
+             std::vector<std::size_t> & items) const;
+
+private:
+  /// Computes the range of cells covered by a box in each dimension
+  void cellRange(const MeshTools::BoundingBox & bbox,
+                 unsigned int min_cell[LIBMESH_DIM],
+                 unsigned int max_cell[LIBMESH_DIM]) const;
+
+  /// All registered boxes and the item that owns each of them
+  std::vector<MeshTools::BoundingBox> _bboxes;
+  std::vector<std::size_t> _owners;
+
+  /// The grid origin, cell size and number of cells per dimension
+  Point _origin;
+  Real _cell_size[LIBMESH_DIM];
+  unsigned int _n_cells[LIBMESH_DIM];
+
+  /// The boxes in each cell: cell i holds _cell_boxes[_cell_offsets[i], _cell_offsets[i + 1])
+  std::vector<std::size_t> _cell_offsets;
+  std::vector<std::size_t> _cell_boxes;
+};
+
+#endif // BOUNDINGBOXINDEX_H
@@ -0,0 +1,152 @@
+/****************************************************************/
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*          All contents are licensed under LGPL V2.1           */
+/*             See LICENSE for full restrictions                */
+/****************************************************************/
+#ifndef SORTEDIDSET_H
+#define SORTEDIDSET_H
+
+#include "DataIO.h"
+#include "Moose.h"
+#include "MooseError.h"
+
+#include "libmesh/id_types.h"
+
+#include <vector>
+
+/**
+ * A set of mesh entity ids stored as a flat sorted vector. It replaces std::set for
+ * the large id sets kept per feature: it needs a fraction of the memory, iterates
+ * over contiguous storage and supports union and difference in place.
+ *
+ * Single insertions are appended to an unsorted tail that finalize() sorts and merges
+ * into the rest (it also runs when the tail grows larger than the sorted part), so
+ * building a set one id at a time stays O(n log n). The non-const accessors finalize
+ * the set before reading it. The const accessors never modify the set, so that any
+ * number of threads can read it, and require it to be finalized.
+ *
+ * As for std::vector, every non-const member function may invalidate iterators.
+ */
+class SortedIdSet
+{
+public:
+  typedef std::vector<dof_id_type>::const_iterator const_iterator;
+
+  SortedIdSet() : _sorted_size(0) {}
+
+  ///@{
+  /// Adds ids to the set
+  void insert(dof_id_type id);
+  template <typename InputIterator>
+  void insert(InputIterator first, InputIterator last)
+  {
+    for (; first != last; ++first)
+      insert(*first);
+  }
+  ///@}
+
+  /// Sorts the pending insertions into the set
+  void finalize();
+
+  /// Whether there are no pending insertions, i.e. the const accessors may be used
+  bool isFinalized() const { return _sorted_size == _ids.size(); }
+
+  ///@{
+  /// Adds all ids of rhs to this set (in place union)
+  void merge(const SortedIdSet & rhs);
+  void merge(SortedIdSet & rhs)
+  {
+    rhs.finalize();
+    merge(static_cast<const SortedIdSet &>(rhs));
+  }
+  ///@}
+
+  ///@{
+  /// Removes all ids of rhs from this set (in place difference)
+  void difference(const SortedIdSet & rhs);
+  void difference(SortedIdSet & rhs)
+  {
+    rhs.finalize();
+    difference(static_cast<const SortedIdSet &>(rhs));
+  }
+  ///@}
+
+  ///@{
+  /// Whether the id is in the set
+  bool contains(dof_id_type id) const;
+  bool contains(dof_id_type id)
+  {
+    finalize();
+    return static_cast<const SortedIdSet &>(*this).contains(id);
+  }
+  ///@}
+
+  ///@{
+  /// Iteration over the ids in ascending order
+  const_iterator begin() const
+  {
+    mooseAssert(isFinalized(), "SortedIdSet must be finalized before it is read");
+    return _ids.begin();
+  }
+  const_iterator end() const
+  {
+    mooseAssert(isFinalized(), "SortedIdSet must be finalized before it is read");
+    return _ids.end();
+  }
+  const_iterator begin()
+  {
+    finalize();
+    return _ids.begin();
+  }
+  const_iterator end()
+  {
+    finalize();
+    return _ids.end();
+  }
+  ///@}
+
+  ///@{
+  /// Number of ids in the set
+  std::size_t size() const
+  {
+    mooseAssert(isFinalized(), "SortedIdSet must be finalized before it is read");
+    return _ids.size();
+  }
+  std::size_t size()
+  {
+    finalize();
+    return _ids.size();
+  }
+  ///@}
+
+  bool empty() const { return _ids.empty(); }
+
+  void clear();
+  void swap(SortedIdSet & rhs);
+
+  /// Releases any memory not needed to hold the current ids
+  void compact();
+
+  ///@{
+  /**
+   * Converts the set to and from a list of [first, count] pairs, one per run of
+   * consecutive ids. This is much smaller than the id list for dense regions.
+   */
+  void toRuns(std::vector<dof_id_type> & runs) const;
+  void fromRuns(const std::vector<dof_id_type> & runs);
+  ///@}
+
+private:
+  /// The ids, _ids[0, _sorted_size) are sorted and unique
+  std::vector<dof_id_type> _ids;
+  std::size_t _sorted_size;
+};
+
+template <>
+void dataStore(std::ostream & stream, SortedIdSet & ids, void * context);
+
+template <>
+void dataLoad(std::istream & stream, SortedIdSet & ids, void * context);
+
+#endif // SORTEDIDSET_H
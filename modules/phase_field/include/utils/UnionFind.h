@@ -0,0 +1,65 @@
+/****************************************************************/
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*          All contents are licensed under LGPL V2.1           */
+/*             See LICENSE for full restrictions                */
+/****************************************************************/
+#ifndef UNIONFIND_H
+#define UNIONFIND_H
+
+#include <cstddef>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * Disjoint set forest over sparse integer keys with union by rank and path
+ * compression. Keys that were never joined are not stored and form their own
+ * set. The representative of every set is its smallest key so the result does
+ * not depend on the order in which the sets were joined.
+ */
+class UnionFind
+{
+public:
+  /// Returns the representative (smallest key) of the set containing key
+  std::size_t find(std::size_t key);
+
+  /// Merges the sets containing a and b
+  void join(std::size_t a, std::size_t b);
+
+  /**
+   * Fills pairs with (key, representative) entries for every stored key that is not
+   * its own representative. Joining these pairs in any UnionFind reproduces the sets.
+   */
+  void compress(std::vector<std::size_t> & pairs);
+
+  /**
+   * Number of links between key and the root of its tree, without compressing the path.
+   * This is bounded by log2 of the size of the set.
+   */
+  unsigned int depth(std::size_t key) const;
+
+  void clear() { _nodes.clear(); }
+
+private:
+  struct Node
+  {
+    /// Parent in the forest, the node itself for roots
+    std::size_t parent;
+
+    /// Upper bound of the height of the tree (roots only)
+    unsigned int rank;
+
+    /// Smallest key of the set (roots only)
+    std::size_t smallest;
+  };
+
+  /// Returns the root of the tree holding key, which must be stored
+  std::size_t findRoot(std::size_t key);
+
+  /// Returns the root of the tree holding key, storing key as a new set if needed
+  std::size_t insert(std::size_t key);
+
+  std::unordered_map<std::size_t, Node> _nodes;
+};
+
+#endif // UNIONFIND_H
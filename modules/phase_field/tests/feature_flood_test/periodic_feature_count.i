@@ -0,0 +1,67 @@
+#
+# Four features that are only connected across the periodic boundaries: a band split by x = 0,
+# a band split by y = 0, a box split into the four corners and an interior box. Without the
+# periodic node pairing they would count as nine.
+#
+
+[Mesh]
+  type = GeneratedMesh
+  dim = 2
+  nx = 20
+  ny = 20
+  xmax = 10
+  ymax = 10
+[]
+
+[Variables]
+  [./u]
+  [../]
+[]
+
+[Functions]
+  [./features]
+    type = ParsedFunction
+    value = 'if((x<1.2|x>8.8)&y>2.2&y<3.8,1,0)+if((y<1.2|y>8.8)&x>4.2&x<5.8,1,0)+
+             if((x<1.2|x>8.8)&(y<1.2|y>8.8),1,0)+if(x>4.2&x<5.8&y>4.2&y<5.8,1,0)'
+  [../]
+[]
+
+[ICs]
+  [./u_ic]
+    type = FunctionIC
+    function = features
+    variable = u
+  [../]
+[]
+
+[BCs]
+  [./Periodic]
+    [./all]
+      variable = u
+      auto_direction = 'x y'
+    [../]
+  [../]
+[]
+
+[Postprocessors]
+  [./flood_count_pp]
+    type = FeatureFloodCount
+    variable = u
+    threshold = 0.6
+    flood_entity_type = NODAL
+    execute_on = 'initial timestep_end'
+  [../]
+[]
+
+[Problem]
+  type = FEProblem
+  solve = false
+[]
+
+[Executioner]
+  type = Steady
+[]
+
+[Outputs]
+  csv = true
+[]
@@ -0,0 +1,146 @@
+#
+# This test checks that DerivativeParsedMaterial, which evaluates the free energy
+# and its derivatives only once for quadrature points with identical arguments,
+# matches the point by point evaluation of ParsedMaterial. c only varies along x,
+# so the quadrature points of an element come in pairs with identical arguments,
+# and it is clamped by the tolerance on the left, where whole elements and parts
+# of elements share a single value.
+#
+
+[Mesh]
+  type = GeneratedMesh
+  dim = 2
+  nx = 10
+  ny = 4
+  xmin = 0
+  xmax = 1
+  ymin = 0
+  ymax = 1
+[]
+
+[Variables]
+  [./u]
+  [../]
+[]
+
+[AuxVariables]
+  [./c]
+  [../]
+[]
+
+[ICs]
+  [./c]
+    type = FunctionIC
+    variable = c
+    function = x
+  [../]
+[]
+
+[Materials]
+  [./free_energy]
+    type = DerivativeParsedMaterial
+    f_name = F
+    args = 'c'
+    function = 'c^2*(1-c)^2+0.1*c*log(c)'
+    tol_names = 'c'
+    tol_values = 0.15
+    derivative_order = 3
+  [../]
+
+  # the same function and its derivatives evaluated at every quadrature point
+  [./F_ref]
+    type = ParsedMaterial
+    f_name = F_ref
+    args = 'c'
+    function = 'c^2*(1-c)^2+0.1*c*log(c)'
+    tol_names = 'c'
+    tol_values = 0.15
+  [../]
+  [./dF_ref]
+    type = ParsedMaterial
+    f_name = dF_ref
+    args = 'c'
+    function = '2*c*(1-c)^2-2*c^2*(1-c)+0.1*(log(c)+1)'
+    tol_names = 'c'
+    tol_values = 0.15
+  [../]
+  [./d2F_ref]
+    type = ParsedMaterial
+    f_name = d2F_ref
+    args = 'c'
+    function = '2*(1-c)^2-8*c*(1-c)+2*c^2+0.1/c'
+    tol_names = 'c'
+    tol_values = 0.15
+  [../]
+  [./d3F_ref]
+    type = ParsedMaterial
+    f_name = d3F_ref
+    args = 'c'
+    function = '-12+24*c-0.1/c^2'
+    tol_names = 'c'
+    tol_values = 0.15
+  [../]
+
+  [./diff0]
+    type = ParsedMaterial
+    f_name = D0
+    function = '(F-F_ref)^2'
+    material_property_names = 'F F_ref'
+  [../]
+  [./diff1]
+    type = ParsedMaterial
+    f_name = D1
+    function = '(dF-dF_ref)^2'
+    material_property_names = 'dF:=D[F,c] dF_ref'
+  [../]
+  [./diff2]
+    type = ParsedMaterial
+    f_name = D2
+    function = '(d2F-d2F_ref)^2'
+    material_property_names = 'd2F:=D[F,c,c] d2F_ref'
+  [../]
+  [./diff3]
+    type = ParsedMaterial
+    f_name = D3
+    function = '(d3F-d3F_ref)^2'
+    material_property_names = 'd3F:=D[F,c,c,c] d3F_ref'
+  [../]
+[]
+
+[Kernels]
+  [./udiff]
+    type = Diffusion
+    variable = u
+  [../]
+[]
+
+[Postprocessors]
+  [./D0]
+    type = ElementIntegralMaterialProperty
+    mat_prop = D0
+  [../]
+  [./D1]
+    type = ElementIntegralMaterialProperty
+    mat_prop = D1
+  [../]
+  [./D2]
+    type = ElementIntegralMaterialProperty
+    mat_prop = D2
+  [../]
+  [./D3]
+    type = ElementIntegralMaterialProperty
+    mat_prop = D3
+  [../]
+[]
+
+[Executioner]
+  type = Steady
+  solve_type = NEWTON
+  l_tol = 1e-03
+[]
+
+[Outputs]
+  execute_on = 'TIMESTEP_END'
+  csv = true
+  print_linear_residuals = false
+[]
@@ -31,7 +31,7 @@ protected:
   const MaterialProperty<std::vector<Real>> * const _pp;
 
   /// d(Nodal pore pressure in each phase)/d(PorousFlow variable)
-  const MaterialProperty<std::vector<std::vector<Real>>> * const _dpp_dvar;
+  const MaterialProperty<PorousFlowDerivativeMatrix<Real>> * const _dpp_dvar;
 
   /// Nodal temperature
   const MaterialProperty<Real> * const _temp;
@@ -39,7 +39,7 @@ protected:
   const MaterialProperty<std::vector<Real>> & _relative_permeability;
 
   /// Derivative of relative permeability of each phase wrt PorousFlow variables
-  const MaterialProperty<std::vector<std::vector<Real>>> & _drelative_permeability_dvar;
+  const MaterialProperty<PorousFlowDerivativeMatrix<Real>> & _drelative_permeability_dvar;
 
   /// Index of the fluid component that this kernel acts on
   const unsigned int _fluid_component;
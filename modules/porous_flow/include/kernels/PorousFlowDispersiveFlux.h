@@ -10,6 +10,7 @@
 
 #include "Kernel.h"
 #include "PorousFlowDictator.h"
+#include "PorousFlowDerivativeMatrix.h"
 #include "RankTwoTensor.h"
 
 class PorousFlowDispersiveFlux;
@@ -46,7 +47,7 @@ protected:
   const MaterialProperty<std::vector<Real>> & _fluid_density_qp;
 
   /// Derivative of the fluid density for each phase wrt PorousFlow variables (at the qp)
-  const MaterialProperty<std::vector<std::vector<Real>>> & _dfluid_density_qp_dvar;
+  const MaterialProperty<PorousFlowDerivativeMatrix<Real>> & _dfluid_density_qp_dvar;
 
   /// Gradient of mass fraction of each component in each phase
   const MaterialProperty<std::vector<std::vector<RealGradient>>> & _grad_mass_frac;
@@ -64,7 +65,7 @@ protected:
   const MaterialProperty<std::vector<Real>> & _tortuosity;
 
   /// Derivative of tortuosity wrt PorousFlow variables
-  const MaterialProperty<std::vector<std::vector<Real>>> & _dtortuosity_dvar;
+  const MaterialProperty<PorousFlowDerivativeMatrix<Real>> & _dtortuosity_dvar;
 
   /// Diffusion coefficients of component k in fluid phase alpha
   const MaterialProperty<std::vector<std::vector<Real>>> & _diffusion_coeff;
@@ -88,13 +89,13 @@ protected:
   const MaterialProperty<std::vector<Real>> & _relative_permeability;
 
   /// Derivative of relative permeability wrt PorousFlow variables
-  const MaterialProperty<std::vector<std::vector<Real>>> & _drelative_permeability_dvar;
+  const MaterialProperty<PorousFlowDerivativeMatrix<Real>> & _drelative_permeability_dvar;
 
   /// Viscosity of each component in each phase
   const MaterialProperty<std::vector<Real>> & _fluid_viscosity;
 
   /// Derivative of viscosity wrt PorousFlow variables
-  const MaterialProperty<std::vector<std::vector<Real>>> & _dfluid_viscosity_dvar;
+  const MaterialProperty<PorousFlowDerivativeMatrix<Real>> & _dfluid_viscosity_dvar;
 
   /// Permeability of porous material
   const MaterialProperty<RealTensorValue> & _permeability;
@@ -109,10 +110,10 @@ protected:
   const MaterialProperty<std::vector<RealGradient>> & _grad_p;
 
   /// Derivative of Grad porepressure in each phase wrt grad(PorousFlow variables)
-  const MaterialProperty<std::vector<std::vector<Real>>> & _dgrad_p_dgrad_var;
+  const MaterialProperty<PorousFlowDerivativeMatrix<Real>> & _dgrad_p_dgrad_var;
 
   /// Derivative of Grad porepressure in each phase wrt PorousFlow variables
-  const MaterialProperty<std::vector<std::vector<RealGradient>>> & _dgrad_p_dvar;
+  const MaterialProperty<PorousFlowDerivativeMatrix<RealGradient>> & _dgrad_p_dvar;
 
   /// Gravitational acceleration
   const RealVectorValue _gravity;
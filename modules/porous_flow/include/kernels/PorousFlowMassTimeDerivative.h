@@ -10,6 +10,7 @@
 
 #include "TimeDerivative.h"
 #include "PorousFlowDictator.h"
+#include "PorousFlowDerivativeMatrix.h"
 
 // Forward Declarations
 class PorousFlowMassTimeDerivative;
@@ -70,7 +71,7 @@ protected:
   const MaterialProperty<std::vector<Real>> & _fluid_density_old;
 
   /// d(nodal fluid density)/d(porous-flow variable)
-  const MaterialProperty<std::vector<std::vector<Real>>> & _dfluid_density_dvar;
+  const MaterialProperty<PorousFlowDerivativeMatrix<Real>> & _dfluid_density_dvar;
 
   /// nodal fluid saturation
   const MaterialProperty<std::vector<Real>> & _fluid_saturation_nodal;
@@ -79,7 +80,7 @@ protected:
   const MaterialProperty<std::vector<Real>> & _fluid_saturation_nodal_old;
 
   /// d(nodal fluid saturation)/d(porous-flow variable)
-  const MaterialProperty<std::vector<std::vector<Real>>> & _dfluid_saturation_nodal_dvar;
+  const MaterialProperty<PorousFlowDerivativeMatrix<Real>> & _dfluid_saturation_nodal_dvar;
 
   /// nodal mass fraction
   const MaterialProperty<std::vector<std::vector<Real>>> & _mass_frac;
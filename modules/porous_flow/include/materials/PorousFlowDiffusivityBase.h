@@ -9,6 +9,7 @@
 #define POROUSFLOWDIFFUSIVITYBASE_H
 
 #include "PorousFlowMaterialVectorBase.h"
+#include "PorousFlowDerivativeMatrix.h"
 
 class PorousFlowDiffusivityBase;
 
@@ -28,7 +29,7 @@ protected:
   MaterialProperty<std::vector<Real>> & _tortuosity;
 
   /// Derivative of tortuosity wrt PorousFlow variables
-  MaterialProperty<std::vector<std::vector<Real>>> & _dtortuosity_dvar;
+  MaterialProperty<PorousFlowDerivativeMatrix<Real>> & _dtortuosity_dvar;
 
   /// Diffusion coefficients of component k in fluid phase alpha
   MaterialProperty<std::vector<std::vector<Real>>> & _diffusion_coeff;
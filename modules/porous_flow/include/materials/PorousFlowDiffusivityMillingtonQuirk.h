@@ -36,7 +36,7 @@ protected:
   /// Saturation of each phase at the qps
   const MaterialProperty<std::vector<Real>> & _saturation_qp;
   /// Derivative of saturation of each phase wrt PorousFlow variables (at the qps)
-  const MaterialProperty<std::vector<std::vector<Real>>> & _dsaturation_qp_dvar;
+  const MaterialProperty<PorousFlowDerivativeMatrix<Real>> & _dsaturation_qp_dvar;
 };
 
 #endif // POROUSFLOWDIFFUSIVITYMILLINGTONQUIRK_H
@@ -186,11 +186,11 @@ protected:
   /// Fluid density of each phase
   MaterialProperty<std::vector<Real>> & _fluid_density;
   /// Derivative of the fluid density for each phase wrt PorousFlow variables
-  MaterialProperty<std::vector<std::vector<Real>>> & _dfluid_density_dvar;
+  MaterialProperty<PorousFlowDerivativeMatrix<Real>> & _dfluid_density_dvar;
   /// Viscosity of each phase
   MaterialProperty<std::vector<Real>> & _fluid_viscosity;
   /// Derivative of the fluid viscosity for each phase wrt PorousFlow variables
-  MaterialProperty<std::vector<std::vector<Real>>> & _dfluid_viscosity_dvar;
+  MaterialProperty<PorousFlowDerivativeMatrix<Real>> & _dfluid_viscosity_dvar;
 
   /// Conversion from degrees Celsius to degrees Kelvin
   const Real _T_c2k;
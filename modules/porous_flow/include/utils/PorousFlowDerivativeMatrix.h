@@ -0,0 +1,109 @@
+/****************************************************************/
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*          All contents are licensed under LGPL V2.1           */
+/*             See LICENSE for full restrictions                */
+/****************************************************************/
+
+#ifndef POROUSFLOWDERIVATIVEMATRIX_H
+#define POROUSFLOWDERIVATIVEMATRIX_H
+
+#include "MooseError.h"
+#include "DataIO.h"
+
+#include <vector>
+
+/**
+ * Dense (phase x PorousFlow variable) matrix with contiguous row-major
+ * storage, used for material properties holding the derivatives of
+ * phase quantities with respect to the PorousFlow variables.
+ *
+ * Entries are accessed as m[phase][pvar], just as for the
+ * std::vector<std::vector<T>> it replaces, but a material property of
+ * this type needs a single allocation per quadpoint rather than one per
+ * phase.  resize() and assign() keep the allocation when the size does
+ * not grow, and so does the copy assignment used to copy and shift
+ * material properties, so after the first evaluation the derivatives
+ * are computed without any allocation.
+ */
+template <typename T>
+class PorousFlowDerivativeMatrix
+{
+public:
+  PorousFlowDerivativeMatrix() : _num_phases(0), _num_var(0) {}
+
+  /// Number of phases, i.e. rows
+  unsigned int size() const { return _num_phases; }
+
+  /// Number of PorousFlow variables, i.e. columns
+  unsigned int numVariables() const { return _num_var; }
+
+  /**
+   * Resizes the matrix, keeping the values stored in the leading
+   * num_phases * num_var entries
+   */
+  void resize(unsigned int num_phases, unsigned int num_var)
+  {
+    _num_phases = num_phases;
+    _num_var = num_var;
+    _values.resize(num_phases * num_var);
+  }
+
+  /// Resizes the matrix and sets all entries to value
+  void assign(unsigned int num_phases, unsigned int num_var, const T & value)
+  {
+    _num_phases = num_phases;
+    _num_var = num_var;
+    _values.assign(num_phases * num_var, value);
+  }
+
+  /// The derivatives of phase ph, indexed by PorousFlow variable number
+  T * operator[](unsigned int ph)
+  {
+    mooseAssert(ph < _num_phases, "Phase " << ph << " out of range " << _num_phases);
+    return _values.data() + ph * _num_var;
+  }
+
+  /// The derivatives of phase ph, indexed by PorousFlow variable number
+  const T * operator[](unsigned int ph) const
+  {
+    mooseAssert(ph < _num_phases, "Phase " << ph << " out of range " << _num_phases);
+    return _values.data() + ph * _num_var;
+  }
+
+protected:
+  /// Number of phases
+  unsigned int _num_phases;
+
+  /// Number of PorousFlow variables
+  unsigned int _num_var;
+
+  /// The entries, (ph, v) is stored at ph * _num_var + v
+  std::vector<T> _values;
+
+  template <typename U>
+  friend void dataStore(std::ostream &, PorousFlowDerivativeMatrix<U> &, void *);
+
+  template <typename U>
+  friend void dataLoad(std::istream &, PorousFlowDerivativeMatrix<U> &, void *);
+};
+
+template <typename T>
+inline void
+dataStore(std::ostream & stream, PorousFlowDerivativeMatrix<T> & m, void * context)
+{
+  storeHelper(stream, m._num_phases, context);
+  storeHelper(stream, m._num_var, context);
+  storeHelper(stream, m._values, context);
+}
+
+template <typename T>
+inline void
+dataLoad(std::istream & stream, PorousFlowDerivativeMatrix<T> & m, void * context)
+{
+  loadHelper(stream, m._num_phases, context);
+  loadHelper(stream, m._num_var, context);
+  loadHelper(stream, m._values, context);
+}
+
+#endif // POROUSFLOWDERIVATIVEMATRIX_H
@@ -23,8 +23,10 @@ InputParameters validParams<InternalSideFluxBase>();
  *
  *   1. When solving a system of equations, fluxes are threated as vectors of all variables.
  *      To avoid recomputing the flux for each equation, we compute it once and store it.
- *      Then, when the flux is needed by another equation,
+ *      Then, when the flux is needed by another equation, or by the neighboring element,
  *      this class just returns the cached value.
+ *      Each thread keeps its own cache, keyed by the side and the states it was computed for,
+ *      so the Riemann problem is solved once per side and no locking is needed.
  *
  *   2. Derived classes need to provide computing of the fluxes and their jacobians,
  *      i.e., they need to implement `calcFlux` and `calcJacobian`.
@@ -112,8 +114,37 @@ public:
                             DenseMatrix<Real> & jac2) const = 0;
 
 protected:
-  mutable unsigned int _cached_elem_id;
-  mutable unsigned int _cached_neig_id;
+  /// the side and states a cached flux or Jacobian was computed for
+  struct SideCache
+  {
+    SideCache() : valid(false) {}
+
+    /// true if the cached value was computed for this side and these states
+    bool matches(dof_id_type ielem,
+                 dof_id_type ineig,
+                 const std::vector<Real> & u1,
+                 const std::vector<Real> & u2,
+                 const RealVectorValue & normal) const;
+
+    /// remember the side and states of a newly computed value
+    void store(dof_id_type ielem,
+               dof_id_type ineig,
+               const std::vector<Real> & u1,
+               const std::vector<Real> & u2,
+               const RealVectorValue & normal);
+
+    bool valid;
+    dof_id_type elem_id;
+    dof_id_type neig_id;
+    std::vector<Real> uvec1;
+    std::vector<Real> uvec2;
+    RealVectorValue dwave;
+  };
+
+  /// side and states of the cached flux of each thread
+  mutable std::vector<SideCache> _flux_cache;
+  /// side and states of the cached Jacobian matrices of each thread
+  mutable std::vector<SideCache> _jac_cache;
 
   /// flux vector of this side
   mutable std::vector<std::vector<Real>> _flux;
@@ -121,9 +152,6 @@ protected:
   mutable std::vector<DenseMatrix<Real>> _jac1;
   /// Jacobian matrix contribution to the "right" cell
   mutable std::vector<DenseMatrix<Real>> _jac2;
-
-private:
-  static Threads::spin_mutex _mutex;
 };
 
 #endif // INTERNALSIDEFLUXBASE_H
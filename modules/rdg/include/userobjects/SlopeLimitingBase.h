@@ -42,8 +42,8 @@ protected:
   virtual void serialize(std::string & serialized_buffer);
   virtual void deserialize(std::vector<std::string> & serialized_buffers);
 
-  /// store the updated slopes into this map indexed by element ID
-  std::map<dof_id_type, std::vector<RealGradient>> _lslope;
+  /// store the updated slopes into this vector indexed by the element index of _rslope
+  std::vector<std::vector<RealGradient>> _lslope;
 
   /// option whether to include BCs
   bool _include_bc;
@@ -65,9 +65,6 @@ protected:
 
   /// the neighboring element
   const Elem *& _neighbor_elem;
-
-private:
-  static Threads::spin_mutex _mutex;
 };
 
 #endif
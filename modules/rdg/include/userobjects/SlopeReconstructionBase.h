@@ -11,6 +11,8 @@
 #include "BCUserObject.h"
 #include "ElementLoopUserObject.h"
 
+#include <unordered_map>
+
 // Forward Declarations
 class SlopeReconstructionBase;
 
@@ -42,6 +44,33 @@ public:
   virtual const std::vector<Real> & getBoundaryAverageValue(dof_id_type elementid,
                                                             unsigned int side) const;
 
+  /// index of a local element or of a neighbor of a local element into the element storage
+  unsigned int elementIndex(dof_id_type elementid) const;
+
+  /// whether an element is a local element or a neighbor of a local element
+  bool isIndexedElement(dof_id_type elementid) const { return _elem_index.count(elementid) > 0; }
+
+  /// number of elements in the element storage: the local elements followed by their neighbors
+  std::size_t numIndexedElements() const { return _elem_index.size(); }
+
+  /// accessor function call to get cached side centroid of an internal or boundary side
+  const Point & getFaceCentroid(dof_id_type elementid, unsigned int side) const
+  {
+    return _side_centroid[sideIndex(elementid, side)];
+  }
+
+  /// accessor function call to get cached side normal of an internal or boundary side
+  const Point & getFaceNormal(dof_id_type elementid, unsigned int side) const
+  {
+    return _side_normal[sideIndex(elementid, side)];
+  }
+
+  /// accessor function call to get cached side area of an internal or boundary side
+  const Real & getFaceArea(dof_id_type elementid, unsigned int side) const
+  {
+    return _side_area[sideIndex(elementid, side)];
+  }
+
   /// accessor function call to get cached internal side centroid
   virtual const Point & getSideCentroid(dof_id_type elementid, dof_id_type neighborid) const;
 
@@ -69,32 +98,47 @@ protected:
   virtual void serialize(std::string & serialized_buffer);
   virtual void deserialize(std::vector<std::string> & serialized_buffers);
 
-  /// store the reconstructed slopes into this map indexed by element ID
-  std::map<dof_id_type, std::vector<RealGradient>> _rslope;
+  /// index of the side of a local element into the flat side storage
+  std::size_t sideIndex(dof_id_type elementid, unsigned int side) const
+  {
+    mooseAssert(side < _max_n_sides, "Side " << side << " is out of range");
+    const unsigned int index = elementIndex(elementid);
+    mooseAssert(index < _n_local_elems, "Element " << elementid << " is not a local element");
+    return static_cast<std::size_t>(index) * _max_n_sides + side;
+  }
+
+  /// (re)build the element index and allocate the flat element and side storage for it
+  void allocateStorage();
+
+  /// index into the element storage of the local elements and their neighbors, by element ID
+  std::unordered_map<dof_id_type, unsigned int> _elem_index;
 
-  /// store the average variable values into this map indexed by element ID
-  std::map<dof_id_type, std::vector<Real>> _avars;
+  /// number of local elements, which come first in the element storage
+  unsigned int _n_local_elems;
 
-  /// store the boundary average variable values into this map indexed by pair of element ID and local side ID
-  std::map<std::pair<dof_id_type, unsigned int>, std::vector<Real>> _bnd_avars;
+  /// local side of an element shared with a neighboring element
+  unsigned int neighborSide(dof_id_type elementid, dof_id_type neighborid) const;
 
-  /// store the side centroid into this map indexed by pair of element ID and neighbor ID
-  std::map<std::pair<dof_id_type, dof_id_type>, Point> _side_centroid;
+  /// maximum number of sides of the local elements, the stride of the side storage
+  unsigned int _max_n_sides;
 
-  /// store the boundary side centroid into this map indexed by pair of element ID and local side ID
-  std::map<std::pair<dof_id_type, unsigned int>, Point> _bnd_side_centroid;
+  /// store the reconstructed slopes into this vector indexed by elementIndex
+  std::vector<std::vector<RealGradient>> _rslope;
 
-  /// store the side area into this map indexed by pair of element ID and neighbor ID
-  std::map<std::pair<dof_id_type, dof_id_type>, Real> _side_area;
+  /// store the average variable values into this vector indexed by elementIndex
+  std::vector<std::vector<Real>> _avars;
 
-  /// store the boundary side area into this map indexed by pair of element ID and local side ID
-  std::map<std::pair<dof_id_type, unsigned int>, Real> _bnd_side_area;
+  /// store the boundary average variable values into this vector indexed by sideIndex
+  std::vector<std::vector<Real>> _bnd_avars;
 
-  /// store the side normal into this map indexed by pair of element ID and neighbor ID
-  std::map<std::pair<dof_id_type, dof_id_type>, Point> _side_normal;
+  /// store the internal and boundary side centroids into this vector indexed by sideIndex
+  std::vector<Point> _side_centroid;
 
-  /// store the boundary side normal into this map indexed by pair of element ID and local side ID
-  std::map<std::pair<dof_id_type, unsigned int>, Point> _bnd_side_normal;
+  /// store the internal and boundary side areas into this vector indexed by sideIndex
+  std::vector<Real> _side_area;
+
+  /// store the internal and boundary side normals into this vector indexed by sideIndex
+  std::vector<Point> _side_normal;
 
   /// required data for face assembly
   const MooseArray<Point> & _q_point_face;
@@ -113,9 +157,6 @@ protected:
 
   /// flag to indicated if side geometry info is cached
   bool _side_geoinfo_cached;
-
-private:
-  static Threads::spin_mutex _mutex;
 };
 
 #endif
@@ -0,0 +1,52 @@
+/****************************************************************/
+/*               DO NOT MODIFY THIS HEADER                      */
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*           (c) 2010 Battelle Energy Alliance, LLC             */
+/*                   ALL RIGHTS RESERVED                        */
+/*                                                              */
+/*          Prepared by Battelle Energy Alliance, LLC           */
+/*            Under Contract No. DE-AC07-05ID14517              */
+/*            With the U. S. Department of Energy               */
+/*                                                              */
+/*            See COPYRIGHT for full restrictions               */
+/****************************************************************/
+
+#ifndef NUMJACOBIANPATTERNCHANGES_H
+#define NUMJACOBIANPATTERNCHANGES_H
+
+#include "GeneralPostprocessor.h"
+
+// Forward Declarations
+class NumJacobianPatternChanges;
+
+template <>
+InputParameters validParams<NumJacobianPatternChanges>();
+
+/**
+ * Counts how many times the nonzero pattern of the Jacobian changed from one evaluation to the
+ * next (the first assembly of the matrix is not counted).  Executed on "nonlinear", i.e. right
+ * before each Jacobian evaluation, it sees the matrix left by the previous one.
+ */
+class NumJacobianPatternChanges : public GeneralPostprocessor
+{
+public:
+  NumJacobianPatternChanges(const InputParameters & parameters);
+
+  virtual void initialize() override {}
+  virtual void execute() override;
+
+  virtual Real getValue() override { return _n_changes; }
+
+protected:
+  /// Number of times the Jacobian was looked at
+  unsigned int _n_observations;
+
+  /// Number of pattern changes seen after the first assembly
+  unsigned int _n_changes;
+
+  /// The nonzero state of the Jacobian at the last observation
+  unsigned long long _last_state;
+};
+
+#endif // NUMJACOBIANPATTERNCHANGES_H
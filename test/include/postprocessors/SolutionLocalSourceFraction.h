@@ -0,0 +1,52 @@
+/****************************************************************/
+/*               DO NOT MODIFY THIS HEADER                      */
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*           (c) 2010 Battelle Energy Alliance, LLC             */
+/*                   ALL RIGHTS RESERVED                        */
+/*                                                              */
+/*          Prepared by Battelle Energy Alliance, LLC           */
+/*            Under Contract No. DE-AC07-05ID14517              */
+/*            With the U. S. Department of Energy               */
+/*                                                              */
+/*            See COPYRIGHT for full restrictions               */
+/****************************************************************/
+
+#ifndef SOLUTIONLOCALSOURCEFRACTION_H
+#define SOLUTIONLOCALSOURCEFRACTION_H
+
+#include "GeneralPostprocessor.h"
+
+// Forward Declarations
+class SolutionLocalSourceFraction;
+class SolutionUserObject;
+
+template <>
+InputParameters validParams<SolutionLocalSourceFraction>();
+
+/**
+ * The largest fraction of the mesh read by a SolutionUserObject that any processor keeps, which
+ * errors out when it exceeds 'max_fraction'
+ */
+class SolutionLocalSourceFraction : public GeneralPostprocessor
+{
+public:
+  SolutionLocalSourceFraction(const InputParameters & parameters);
+
+  virtual void initialize() override {}
+  virtual void execute() override;
+
+  virtual Real getValue() override { return _fraction; }
+
+protected:
+  /// The SolutionUserObject reading the mesh
+  const SolutionUserObject & _solution;
+
+  /// The largest fraction allowed
+  const Real _max_fraction;
+
+  /// The largest fraction of the mesh kept by a processor
+  Real _fraction;
+};
+
+#endif // SOLUTIONLOCALSOURCEFRACTION_H
@@ -0,0 +1,86 @@
+###########################################################
+# This is a test of the GeometricSearchTime postprocessor,
+# which reports the time spent in the nearest node search
+# used by the NearestNodeDistanceAux Auxilary Kernel.
+###########################################################
+
+[Mesh]
+  file = 2dcontact_collide.e
+[]
+
+[Variables]
+  [./u]
+    order = FIRST
+    family = LAGRANGE
+  [../]
+[]
+
+[AuxVariables]
+  [./distance]
+  [../]
+[]
+
+[Kernels]
+  [./diff]
+    type = Diffusion
+    variable = u
+  [../]
+[]
+
+[AuxKernels]
+  [./distance]
+    type = NearestNodeDistanceAux
+    variable = distance
+    boundary = 2
+    paired_boundary = 3
+  [../]
+[]
+
+[BCs]
+  [./block1_left]
+    type = DirichletBC
+    variable = u
+    boundary = 1
+    value = 0
+  [../]
+  [./block1_right]
+    type = DirichletBC
+    variable = u
+    boundary = 2
+    value = 1
+  [../]
+  [./block2_left]
+    type = DirichletBC
+    variable = u
+    boundary = 3
+    value = 0
+  [../]
+  [./block2_right]
+    type = DirichletBC
+    variable = u
+    boundary = 4
+    value = 1
+  [../]
+[]
+
+[Executioner]
+  type = Steady
+
+  # Preconditioned JFNK (default)
+  solve_type = 'PJFNK'
+
+[]
+
+[Postprocessors]
+  [./patch_update_time]
+    type = GeometricSearchTime
+    search = patch_update
+  [../]
+  [./search_time]
+    type = GeometricSearchTime
+  [../]
+[]
+
+[Outputs]
+  csv = true
+[]
@@ -0,0 +1,95 @@
+# The off-diagonal blocks only get contributions from Kernels with a constant Jacobian, which
+# are skipped when the Jacobian is assembled.  Its nonzero pattern must not change from one
+# evaluation to the next.
+[Mesh]
+  type = GeneratedMesh
+  dim = 2
+  nx = 8
+  ny = 8
+[]
+
+[Variables]
+  [./u]
+  [../]
+  [./v]
+  [../]
+[]
+
+[Kernels]
+  [./time_u]
+    type = TimeDerivative
+    variable = u
+  [../]
+  [./diff_u]
+    type = Diffusion
+    variable = u
+    constant_jacobian = true
+  [../]
+  [./coupled_u]
+    type = CoupledKernelValueTest
+    variable = u
+    var2 = v
+    constant_jacobian = true
+  [../]
+  [./time_v]
+    type = TimeDerivative
+    variable = v
+  [../]
+  [./diff_v]
+    type = Diffusion
+    variable = v
+    constant_jacobian = true
+  [../]
+  [./coupled_v]
+    type = CoupledKernelValueTest
+    variable = v
+    var2 = u
+    constant_jacobian = true
+  [../]
+[]
+
+[BCs]
+  [./left_u]
+    type = DirichletBC
+    variable = u
+    boundary = left
+    value = 0
+  [../]
+  [./right_u]
+    type = DirichletBC
+    variable = u
+    boundary = right
+    value = 1
+  [../]
+  [./top_v]
+    type = NeumannBC
+    variable = v
+    boundary = top
+    value = 1
+  [../]
+[]
+
+[Preconditioning]
+  [./prec]
+    type = SMP
+    full = true
+  [../]
+[]
+
+[Postprocessors]
+  [./pattern_changes]
+    type = NumJacobianPatternChanges
+  [../]
+[]
+
+[Executioner]
+  type = Transient
+  num_steps = 3
+  dt = 0.1
+  solve_type = NEWTON
+  nl_rel_tol = 1e-12
+[]
+
+[Outputs]
+  csv = true
+[]
@@ -0,0 +1,142 @@
+#
+# Transient coupled problem solved with the matrix-free Jacobian operator. The exact solution
+# u = v = x*t is reproduced by linear elements and implicit Euler, so the errors are at the level
+# of the solver tolerances. The default block-diagonal preconditioner leaves the coupling of v to
+# u to the operator.
+#
+
+[Mesh]
+  type = GeneratedMesh
+  dim = 2
+  nx = 8
+  ny = 8
+  elem_type = QUAD4
+[]
+
+[Variables]
+  [./u]
+  [../]
+  [./v]
+  [../]
+[]
+
+[Functions]
+  [./exact_fn]
+    type = ParsedFunction
+    value = x*t
+  [../]
+
+  [./u_forcing_fn]
+    type = ParsedFunction
+    value = x
+  [../]
+
+  [./v_forcing_fn]
+    type = ParsedFunction
+    value = x-x*t
+  [../]
+
+  [./flux_fn]
+    type = ParsedFunction
+    value = t
+  [../]
+[]
+
+[Kernels]
+  [./u_ie]
+    type = TimeDerivative
+    variable = u
+  [../]
+  [./u_diff]
+    type = Diffusion
+    variable = u
+  [../]
+  [./u_forcing]
+    type = UserForcingFunction
+    variable = u
+    function = u_forcing_fn
+  [../]
+
+  [./v_ie]
+    type = TimeDerivative
+    variable = v
+  [../]
+  [./v_diff]
+    type = Diffusion
+    variable = v
+  [../]
+  [./v_coupled]
+    type = CoupledForce
+    variable = v
+    v = u
+  [../]
+  [./v_forcing]
+    type = UserForcingFunction
+    variable = v
+    function = v_forcing_fn
+  [../]
+[]
+
+[BCs]
+  [./left_u]
+    type = DirichletBC
+    variable = u
+    boundary = left
+    value = 0
+  [../]
+  [./right_u]
+    type = FunctionNeumannBC
+    variable = u
+    boundary = right
+    function = flux_fn
+  [../]
+
+  [./left_v]
+    type = DirichletBC
+    variable = v
+    boundary = left
+    value = 0
+  [../]
+  [./right_v]
+    type = FunctionNeumannBC
+    variable = v
+    boundary = right
+    function = flux_fn
+  [../]
+  [./right_v_penalty]
+    # Vanishes for the exact solution but contributes to the Jacobian
+    type = FunctionPenaltyDirichletBC
+    variable = v
+    boundary = right
+    function = exact_fn
+    penalty = 10
+  [../]
+[]
+
+[Postprocessors]
+  [./error_u]
+    type = ElementL2Error
+    variable = u
+    function = exact_fn
+  [../]
+  [./error_v]
+    type = ElementL2Error
+    variable = v
+    function = exact_fn
+  [../]
+[]
+
+[Executioner]
+  type = Transient
+  solve_type = MATRIX_FREE
+
+  num_steps = 3
+  dt = 0.1
+
+  nl_rel_tol = 1e-12
+  l_tol = 1e-12
+[]
+
+[Outputs]
+  csv = true
+[]
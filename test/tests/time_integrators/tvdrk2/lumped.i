@@ -0,0 +1,56 @@
+# u' = 3, so that u = 3*t and the time derivative seen by the
+# postprocessors at the end of each step is 3, not the u_dot = 1 used
+# internally to compute the lumped mass matrix.
+[Mesh]
+  type = GeneratedMesh
+  dim = 1
+  nx = 4
+[]
+
+[Variables]
+  [./u]
+  [../]
+[]
+
+[Kernels]
+  [./time]
+    type = TimeDerivative
+    variable = u
+  [../]
+
+  [./source]
+    type = BodyForce
+    variable = u
+    value = 3
+    implicit = false
+  [../]
+[]
+
+[Postprocessors]
+  [./u]
+    type = ElementAverageValue
+    variable = u
+  [../]
+
+  [./u_dot]
+    type = ElementAverageTimeDerivative
+    variable = u
+  [../]
+[]
+
+[Executioner]
+  type = Transient
+
+  [./TimeIntegrator]
+    type = LumpedExplicitTVDRK2
+  [../]
+  solve_type = 'LINEAR'
+
+  start_time = 0.0
+  num_steps = 3
+  dt = 0.1
+[]
+
+[Outputs]
+  csv = true
+[]
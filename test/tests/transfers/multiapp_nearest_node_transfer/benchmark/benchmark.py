@@ -0,0 +1,55 @@
+#!/usr/bin/env python
+"""
+Compare the time spent in MultiAppNearestNodeTransfer using the KDTree search
+against the linear scan for source/target meshes of roughly 10k, 100k and 1M nodes.
+
+Usage: ./benchmark.py [--exec ../../../../moose_test-opt] [--mpi N]
+
+The transfer times are read from the performance log printed at the end of the
+run: MultiAppNearestNodeTransfer::execute() logs one row per transfer object,
+named after the transfer, in the "MultiAppNearestNodeTransfer" section.
+"""
+import os, re, subprocess, argparse
+
+# Number of elements per side of the cube giving ~10k, ~100k and ~1M nodes
+SIZES = [(21, '10k'), (46, '100k'), (99, '1M')]
+METHODS = ['kdtree', 'linear']
+TRANSFERS = ['to_sub', 'from_sub']
+
+def transferTime(output, name):
+    """Return the total time of the perf log row for the named transfer."""
+    # Rows look like: |   name   n_calls   total_time   avg_time   total_with_sub ... |
+    for line in output.splitlines():
+        fields = line.replace('|', ' ').split()
+        if len(fields) >= 3 and fields[0] == name:
+            return float(fields[2])
+    raise RuntimeError("No performance log row for the transfer '%s'" % name)
+
+def run(args, n, method):
+    cmd = [args.exec_path, '-i', 'benchmark_master.i',
+           'Mesh/nx=%d' % n, 'Mesh/ny=%d' % n, 'Mesh/nz=%d' % n,
+           'sub0:Mesh/nx=%d' % n, 'sub0:Mesh/ny=%d' % n, 'sub0:Mesh/nz=%d' % n]
+    cmd += ['Transfers/%s/search_method=%s' % (t, method) for t in TRANSFERS]
+    if args.mpi > 1:
+        cmd = ['mpiexec', '-n', str(args.mpi)] + cmd
+    output = subprocess.check_output(cmd, cwd=os.path.dirname(os.path.abspath(__file__)))
+    return [transferTime(output.decode('utf-8'), t) for t in TRANSFERS]
+
+if __name__ == '__main__':
+    default_exec = os.path.join(os.path.dirname(os.path.abspath(__file__)),
+                                '..', '..', '..', '..', 'moose_test-opt')
+    parser = argparse.ArgumentParser(description='Benchmark the nearest node transfer search.')
+    parser.add_argument('--exec', dest='exec_path', default=default_exec,
+                        help='The MOOSE test executable')
+    parser.add_argument('--mpi', type=int, default=1, help='Number of MPI processes')
+    parser.add_argument('--max-size', default='1M', choices=[s[1] for s in SIZES],
+                        help='The largest problem size to run')
+    args = parser.parse_args()
+
+    print('%-6s %-8s %12s %12s' % ('nodes', 'method', 'to_sub (s)', 'from_sub (s)'))
+    for n, label in SIZES:
+        for method in METHODS:
+            times = run(args, n, method)
+            print('%-6s %-8s %12.4f %12.4f' % ((label, method) + tuple(times)))
+        if label == args.max_size:
+            break
@@ -0,0 +1,69 @@
+# Timing benchmark for the nearest node search in MultiAppNearestNodeTransfer.
+# Run through benchmark.py, which scales the meshes and switches the search method.
+[Mesh]
+  type = GeneratedMesh
+  dim = 3
+  nx = 21
+  ny = 21
+  nz = 21
+[]
+
+[Variables]
+  [./u]
+  [../]
+[]
+
+[AuxVariables]
+  [./from_sub]
+  [../]
+[]
+
+[ICs]
+  [./u]
+    type = FunctionIC
+    variable = u
+    function = 'x + 2 * y + 3 * z'
+  [../]
+[]
+
+[Problem]
+  type = FEProblem
+  solve = false
+[]
+
+[Executioner]
+  type = Transient
+  num_steps = 2
+  dt = 1
+[]
+
+[Outputs]
+  print_perf_log = true
+[]
+
+[MultiApps]
+  [./sub]
+    type = TransientMultiApp
+    app_type = MooseTestApp
+    execute_on = timestep_end
+    positions = '0.01 0.01 0.01'
+    input_files = benchmark_sub.i
+  [../]
+[]
+
+[Transfers]
+  [./to_sub]
+    type = MultiAppNearestNodeTransfer
+    direction = to_multiapp
+    multi_app = sub
+    source_variable = u
+    variable = from_master
+  [../]
+  [./from_sub]
+    type = MultiAppNearestNodeTransfer
+    direction = from_multiapp
+    multi_app = sub
+    source_variable = v
+    variable = from_sub
+  [../]
+[]
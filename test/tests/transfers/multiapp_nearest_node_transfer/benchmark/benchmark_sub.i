@@ -0,0 +1,36 @@
+[Mesh]
+  type = GeneratedMesh
+  dim = 3
+  nx = 21
+  ny = 21
+  nz = 21
+[]
+
+[Variables]
+  [./v]
+  [../]
+[]
+
+[AuxVariables]
+  [./from_master]
+  [../]
+[]
+
+[ICs]
+  [./v]
+    type = FunctionIC
+    variable = v
+    function = 'x * y * z'
+  [../]
+[]
+
+[Problem]
+  type = FEProblem
+  solve = false
+[]
+
+[Executioner]
+  type = Transient
+  num_steps = 2
+  dt = 1
+[]
@@ -0,0 +1,45 @@
+/****************************************************************/
+/*               DO NOT MODIFY THIS HEADER                      */
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*           (c) 2010 Battelle Energy Alliance, LLC             */
+/*                   ALL RIGHTS RESERVED                        */
+/*                                                              */
+/*          Prepared by Battelle Energy Alliance, LLC           */
+/*            Under Contract No. DE-AC07-05ID14517              */
+/*            With the U. S. Department of Energy               */
+/*                                                              */
+/*            See COPYRIGHT for full restrictions               */
+/****************************************************************/
+
+#ifndef BOUNDINGBOXINDEXTEST_H
+#define BOUNDINGBOXINDEXTEST_H
+
+// CPPUnit includes
+#include "cppunit/extensions/HelperMacros.h"
+
+class BoundingBoxIndexTest : public CppUnit::TestFixture
+{
+  CPPUNIT_TEST_SUITE(BoundingBoxIndexTest);
+
+  CPPUNIT_TEST(empty);
+  CPPUNIT_TEST(overlap);
+  CPPUNIT_TEST(outsideGrid);
+  CPPUNIT_TEST(periodicPieces);
+  CPPUNIT_TEST(translated);
+  CPPUNIT_TEST(bruteForce);
+  CPPUNIT_TEST(rebuild);
+
+  CPPUNIT_TEST_SUITE_END();
+
+public:
+  void empty();
+  void overlap();
+  void outsideGrid();
+  void periodicPieces();
+  void translated();
+  void bruteForce();
+  void rebuild();
+};
+
+#endif // BOUNDINGBOXINDEXTEST_H
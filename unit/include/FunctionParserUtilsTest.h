@@ -0,0 +1,43 @@
+/****************************************************************/
+/*               DO NOT MODIFY THIS HEADER                      */
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*           (c) 2010 Battelle Energy Alliance, LLC             */
+/*                   ALL RIGHTS RESERVED                        */
+/*                                                              */
+/*          Prepared by Battelle Energy Alliance, LLC           */
+/*            Under Contract No. DE-AC07-05ID14517              */
+/*            With the U. S. Department of Energy               */
+/*                                                              */
+/*            See COPYRIGHT for full restrictions               */
+/****************************************************************/
+
+#ifndef FUNCTIONPARSERUTILSTEST_H
+#define FUNCTIONPARSERUTILSTEST_H
+
+// CPPUnit includes
+#include "GuardedHelperMacros.h"
+
+// libMesh includes
+#include "libmesh/fparser_ad.hh"
+
+// MOOSE includes
+#include "FunctionParserUtils.h"
+
+class FunctionParserUtilsTest : public CppUnit::TestFixture, public FunctionParserUtils
+{
+  CPPUNIT_TEST_SUITE(FunctionParserUtilsTest);
+
+  CPPUNIT_TEST(evaluateParams);
+  CPPUNIT_TEST(evaluateErrors);
+
+  CPPUNIT_TEST_SUITE_END();
+
+public:
+  FunctionParserUtilsTest();
+
+  void evaluateParams();
+  void evaluateErrors();
+};
+
+#endif // FUNCTIONPARSERUTILSTEST_H
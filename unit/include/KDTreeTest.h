@@ -0,0 +1,51 @@
+/****************************************************************/
+/*               DO NOT MODIFY THIS HEADER                      */
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*           (c) 2010 Battelle Energy Alliance, LLC             */
+/*                   ALL RIGHTS RESERVED                        */
+/*                                                              */
+/*          Prepared by Battelle Energy Alliance, LLC           */
+/*            Under Contract No. DE-AC07-05ID14517              */
+/*            With the U. S. Department of Energy               */
+/*                                                              */
+/*            See COPYRIGHT for full restrictions               */
+/****************************************************************/
+
+#ifndef KDTREETEST_H
+#define KDTREETEST_H
+
+// CPPUnit includes
+#include "GuardedHelperMacros.h"
+
+// Moose includes
+#include "KDTree.h"
+
+class KDTreeTest : public CppUnit::TestFixture
+{
+  CPPUNIT_TEST_SUITE(KDTreeTest);
+
+  CPPUNIT_TEST(nearestTest);
+  CPPUNIT_TEST(neighborSearchTest);
+  CPPUNIT_TEST(tieBreakTest);
+  CPPUNIT_TEST(refitTest);
+
+  CPPUNIT_TEST_SUITE_END();
+
+public:
+  void setUp();
+
+  void nearestTest();
+  void neighborSearchTest();
+  void tieBreakTest();
+  void refitTest();
+
+private:
+  /// Indices of all points sorted by distance to p, computed by brute force
+  std::vector<std::size_t> bruteForce(const std::vector<Point> & points, const Point & p);
+
+  std::vector<Point> _points;
+  std::vector<Point> _queries;
+};
+
+#endif // KDTREETEST_H
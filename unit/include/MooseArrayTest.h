@@ -33,6 +33,7 @@ class MooseArrayTest : public CppUnit::TestFixture
   CPPUNIT_TEST(access);
   CPPUNIT_TEST(shallowCopy);
   CPPUNIT_TEST(shallowCopyStdVector);
+  CPPUNIT_TEST(shallowCopyPointer);
   CPPUNIT_TEST(operatorEqualsStdVector);
   CPPUNIT_TEST(stdVector);
 
@@ -53,6 +54,7 @@ public:
   void access();
   void shallowCopy();
   void shallowCopyStdVector();
+  void shallowCopyPointer();
   void operatorEqualsStdVector();
   void stdVector();
 
@@ -0,0 +1,66 @@
+/****************************************************************/
+/*               DO NOT MODIFY THIS HEADER                      */
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*           (c) 2010 Battelle Energy Alliance, LLC             */
+/*                   ALL RIGHTS RESERVED                        */
+/*                                                              */
+/*          Prepared by Battelle Energy Alliance, LLC           */
+/*            Under Contract No. DE-AC07-05ID14517              */
+/*            With the U. S. Department of Energy               */
+/*                                                              */
+/*            See COPYRIGHT for full restrictions               */
+/****************************************************************/
+
+#ifndef MOOSEMESHTEST_H
+#define MOOSEMESHTEST_H
+
+// CPPUnit includes
+#include "GuardedHelperMacros.h"
+
+// Moose includes
+#include "MooseTypes.h"
+
+// Forward declarations
+class MooseMesh;
+class Factory;
+class MooseApp;
+
+class MooseMeshTest : public CppUnit::TestFixture
+{
+
+  CPPUNIT_TEST_SUITE(MooseMeshTest);
+
+  CPPUNIT_TEST(addUniqueNode);
+  CPPUNIT_TEST(addUniqueNodeToleranceChange);
+  CPPUNIT_TEST(addUniqueNodes);
+
+  CPPUNIT_TEST_SUITE_END();
+
+public:
+  void setUp();
+  void tearDown();
+
+  void addUniqueNode();
+  void addUniqueNodeToleranceChange();
+  void addUniqueNodes();
+
+protected:
+  /// Builds a 4x4 GeneratedMesh of the unit square
+  MooseMesh * buildMesh();
+
+  /**
+   * Adds the point with addUniqueNode() and checks that it returns the node a linear search
+   * with relative_fuzzy_equals() finds, or a new node at the point if there is none
+   */
+  void checkUniqueNode(const Point & p, Real tol);
+
+  /// Points around every node of the mesh, on both sides of the tolerance and of hash cell borders
+  std::vector<Point> testPoints(Real tol);
+
+  MooseApp * _app;
+  Factory * _factory;
+  MooseMesh * _mesh;
+};
+
+#endif // MOOSEMESHTEST_H
@@ -31,12 +31,14 @@ class MooseUtilsTest : public CppUnit::TestFixture
 
   CPPUNIT_TEST(camelCaseToUnderscore);
   CPPUNIT_TEST(underscoreToCamelCase);
+  CPPUNIT_TEST(getRecoveryFileBase);
 
   CPPUNIT_TEST_SUITE_END();
 
 public:
   void camelCaseToUnderscore();
   void underscoreToCamelCase();
+  void getRecoveryFileBase();
 };
 
 #endif // MOOSEUTILSTEST_H
@@ -30,6 +30,9 @@ class RankTwoEigenRoutinesTest : public CppUnit::TestFixture
   CPPUNIT_TEST(dsymmetricEigenvaluesTest);
   CPPUNIT_TEST(d2symmetricEigenvaluesTest1);
   CPPUNIT_TEST(d2symmetricEigenvaluesTest2);
+  CPPUNIT_TEST(lapackComparisonTest);
+  CPPUNIT_TEST(symmetricEigenvaluesEigenvectorsTest);
+  CPPUNIT_TEST(getRUDecompositionRotationTest);
 
   CPPUNIT_TEST(someIdentitiesTest);
 
@@ -43,6 +46,9 @@ public:
   void dsymmetricEigenvaluesTest();
   void d2symmetricEigenvaluesTest1();
   void d2symmetricEigenvaluesTest2();
+  void lapackComparisonTest();
+  void symmetricEigenvaluesEigenvectorsTest();
+  void getRUDecompositionRotationTest();
 
   void someIdentitiesTest();
 
@@ -0,0 +1,43 @@
+/****************************************************************/
+/*               DO NOT MODIFY THIS HEADER                      */
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*           (c) 2010 Battelle Energy Alliance, LLC             */
+/*                   ALL RIGHTS RESERVED                        */
+/*                                                              */
+/*          Prepared by Battelle Energy Alliance, LLC           */
+/*            Under Contract No. DE-AC07-05ID14517              */
+/*            With the U. S. Department of Energy               */
+/*                                                              */
+/*            See COPYRIGHT for full restrictions               */
+/****************************************************************/
+
+#ifndef SORTEDIDSETTEST_H
+#define SORTEDIDSETTEST_H
+
+// CPPUnit includes
+#include "GuardedHelperMacros.h"
+
+class SortedIdSetTest : public CppUnit::TestFixture
+{
+  CPPUNIT_TEST_SUITE(SortedIdSetTest);
+
+  CPPUNIT_TEST(insert);
+  CPPUNIT_TEST(merge);
+  CPPUNIT_TEST(difference);
+  CPPUNIT_TEST(contains);
+  CPPUNIT_TEST(runs);
+  CPPUNIT_TEST(serialization);
+
+  CPPUNIT_TEST_SUITE_END();
+
+public:
+  void insert();
+  void merge();
+  void difference();
+  void contains();
+  void runs();
+  void serialization();
+};
+
+#endif // SORTEDIDSETTEST_H
@@ -0,0 +1,56 @@
+/****************************************************************/
+/*               DO NOT MODIFY THIS HEADER                      */
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*           (c) 2010 Battelle Energy Alliance, LLC             */
+/*                   ALL RIGHTS RESERVED                        */
+/*                                                              */
+/*          Prepared by Battelle Energy Alliance, LLC           */
+/*            Under Contract No. DE-AC07-05ID14517              */
+/*            With the U. S. Department of Energy               */
+/*                                                              */
+/*            See COPYRIGHT for full restrictions               */
+/****************************************************************/
+
+#ifndef SYMMETRICRANKFOURTENSORTEST_H
+#define SYMMETRICRANKFOURTENSORTEST_H
+
+// CPPUnit includes
+#include "GuardedHelperMacros.h"
+
+// Moose includes
+#include "SymmetricRankFourTensor.h"
+#include "RankTwoTensor.h"
+
+class SymmetricRankFourTensorTest : public CppUnit::TestFixture
+{
+
+  CPPUNIT_TEST_SUITE(SymmetricRankFourTensorTest);
+
+  CPPUNIT_TEST(conversionTest);
+  CPPUNIT_TEST(contractionTest);
+  CPPUNIT_TEST(invSymmTest);
+  CPPUNIT_TEST(rotateTest);
+
+  CPPUNIT_TEST_SUITE_END();
+
+public:
+  SymmetricRankFourTensorTest();
+  ~SymmetricRankFourTensorTest();
+
+  void conversionTest();
+  void contractionTest();
+  void invSymmTest();
+  void rotateTest();
+
+private:
+  /// has C_ijkl = C_jikl = C_ijlk but not C_ijkl = C_klij
+  RankFourTensor _a;
+
+  /// symmetric21 filled tensor
+  RankFourTensor _b;
+
+  RankTwoTensor _unsymmetric;
+};
+
+#endif // SYMMETRICRANKFOURTENSORTEST_H
@@ -0,0 +1,43 @@
+/****************************************************************/
+/*               DO NOT MODIFY THIS HEADER                      */
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*           (c) 2010 Battelle Energy Alliance, LLC             */
+/*                   ALL RIGHTS RESERVED                        */
+/*                                                              */
+/*          Prepared by Battelle Energy Alliance, LLC           */
+/*            Under Contract No. DE-AC07-05ID14517              */
+/*            With the U. S. Department of Energy               */
+/*                                                              */
+/*            See COPYRIGHT for full restrictions               */
+/****************************************************************/
+
+#ifndef UNIONFINDTEST_H
+#define UNIONFINDTEST_H
+
+// CPPUnit includes
+#include "cppunit/extensions/HelperMacros.h"
+
+class UnionFindTest : public CppUnit::TestFixture
+{
+  CPPUNIT_TEST_SUITE(UnionFindTest);
+
+  CPPUNIT_TEST(singletons);
+  CPPUNIT_TEST(smallestRepresentative);
+  CPPUNIT_TEST(pathCompression);
+  CPPUNIT_TEST(unionByRank);
+  CPPUNIT_TEST(compress);
+  CPPUNIT_TEST(reduceAcrossRanks);
+
+  CPPUNIT_TEST_SUITE_END();
+
+public:
+  void singletons();
+  void smallestRepresentative();
+  void pathCompression();
+  void unionByRank();
+  void compress();
+  void reduceAcrossRanks();
+};
+
+#endif // UNIONFINDTEST_H